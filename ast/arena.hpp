@@ -0,0 +1,134 @@
+#pragma once
+
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <new>
+#include <utility>
+#include <vector>
+
+namespace jackal::ast
+{
+/// @brief Deleter for objects owned by an Arena.
+///
+/// Arena-owned objects are never destroyed individually; their storage is released all at once
+/// when the Arena is destroyed.
+struct ArenaRelease
+{
+  constexpr void operator()(void const* /*unused*/) const noexcept {}
+};
+
+/// @brief A unique handle to an object whose storage is owned by an Arena.
+template <typename T>
+using ArenaPtr = std::unique_ptr<T, ArenaRelease>;
+
+/// @brief A bump allocator that owns every node of one compilation's syntax tree.
+///
+/// Allocation is a pointer increment within the current block; when a block is exhausted a new
+/// one is requested from the heap. Nothing is freed until the Arena itself is destroyed, at which
+/// point every block is released at once.
+///
+/// Destructors of arena-allocated objects are never run. Objects placed in an Arena must therefore
+/// not own memory outside of it; containers should use an ArenaAllocator.
+///
+/// Every object allocated from an Arena must not outlive it.
+struct Arena
+{
+  static constexpr std::size_t DefaultBlockSize = 64 * 1024;
+
+  Arena() noexcept = default;
+  explicit Arena(std::size_t blockSize) noexcept : _blockSize(blockSize) {}
+
+  ~Arena() noexcept = default;
+  Arena(Arena const&) = delete;
+  Arena& operator=(Arena const&) = delete;
+  Arena(Arena&&) noexcept = delete;
+  Arena& operator=(Arena&&) noexcept = delete;
+
+  /// @brief Allocates uninitialized storage.
+  ///
+  /// @param size the number of bytes to allocate
+  /// @param alignment the required alignment of the storage; must be a power of two
+  /// @returns a pointer to at least @p size bytes aligned to @p alignment
+  [[nodiscard]] void* allocate(std::size_t size, std::size_t alignment) noexcept
+  {
+    assert((alignment & (alignment - 1)) == 0);
+    auto cursor = reinterpret_cast<std::uintptr_t>(_cursor);  // NOLINT
+    auto aligned = (cursor + alignment - 1) & ~(alignment - 1);
+    if (_cursor == nullptr || aligned + size > reinterpret_cast<std::uintptr_t>(_end))  // NOLINT
+    {
+      return allocate_block(size, alignment);
+    }
+
+    _cursor = reinterpret_cast<std::byte*>(aligned + size);  // NOLINT
+    _bytesAllocated += size;
+    return reinterpret_cast<void*>(aligned);  // NOLINT
+  }
+
+  /// @brief Constructs an object in storage owned by the Arena.
+  ///
+  /// @param args the arguments forwarded to the constructor of @p T
+  /// @returns a handle to the constructed object
+  template <typename T, typename... Args>
+  [[nodiscard]] ArenaPtr<T> make(Args&&... args) noexcept
+  {
+    void* storage = allocate(sizeof(T), alignof(T));
+    return ArenaPtr<T>(new (storage) T(std::forward<Args>(args)...));
+  }
+
+  /// @returns the number of bytes handed out by the Arena, excluding alignment padding
+  [[nodiscard]] std::size_t bytes_allocated() const noexcept { return _bytesAllocated; }
+
+  /// @returns the number of blocks requested from the heap
+  [[nodiscard]] std::size_t block_count() const noexcept { return _blocks.size(); }
+
+ private:
+  [[nodiscard]] void* allocate_block(std::size_t size, std::size_t alignment) noexcept;
+
+ private:
+  std::vector<std::unique_ptr<std::byte[]>> _blocks;  // NOLINT
+  std::byte* _cursor = nullptr;
+  std::byte* _end = nullptr;
+  std::size_t _blockSize = DefaultBlockSize;
+  std::size_t _bytesAllocated = 0;
+};
+
+/// @brief A standard allocator that draws from an Arena.
+///
+/// Deallocation is a no-op: storage released by a container (for example, when a std::vector
+/// grows) is reclaimed only when the Arena is destroyed.
+///
+/// @tparam T the allocated element type
+template <typename T>
+struct ArenaAllocator
+{
+  using value_type = T;
+
+  explicit ArenaAllocator(Arena& arena) noexcept : _arena(&arena) {}
+
+  template <typename U>
+  ArenaAllocator(ArenaAllocator<U> const& other) noexcept  // NOLINT
+      : _arena(&other.arena())
+  {
+  }
+
+  [[nodiscard]] T* allocate(std::size_t count) noexcept
+  {
+    return static_cast<T*>(_arena->allocate(count * sizeof(T), alignof(T)));
+  }
+
+  void deallocate(T* /*unused*/, std::size_t /*unused*/) noexcept {}
+
+  [[nodiscard]] Arena& arena() const noexcept { return *_arena; }
+
+  template <typename U>
+  [[nodiscard]] bool operator==(ArenaAllocator<U> const& other) const noexcept
+  {
+    return _arena == &other.arena();
+  }
+
+ private:
+  Arena* _arena;
+};
+}  // namespace jackal::ast
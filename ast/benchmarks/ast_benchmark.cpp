@@ -0,0 +1,153 @@
+/// @file Measures the cost of building and tearing down syntax trees.
+///
+/// Usage: jackal_ast_benchmark
+///
+/// Builds a large synthetic program through the AST Builders in the same order the Parser does,
+/// then reports the number of heap allocations performed per instruction alongside the time
+/// spent constructing the tree and releasing it.
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <iostream>
+#include <memory>
+#include <new>
+#include <string>
+#include <vector>
+
+#include "ast/arena.hpp"
+#include "ast/expression.hpp"
+#include "ast/operator.hpp"
+#include "ast/program.hpp"
+#include "ast/value.hpp"
+#include "util/interner.hpp"
+
+using jackal::ast::Arena;
+using jackal::ast::Expression;
+using jackal::ast::Instruction;
+using jackal::ast::Operator;
+using jackal::ast::Program;
+using jackal::ast::Value;
+using jackal::util::Interner;
+using jackal::util::Symbol;
+
+namespace
+{
+constexpr auto Iterations = 10;
+constexpr auto SyntheticLines = 200000;
+
+std::size_t heapAllocations = 0;  // NOLINT
+}  // namespace
+
+auto operator new(std::size_t size) -> void*
+{
+  ++heapAllocations;
+  if (void* ptr = std::malloc(size))  // NOLINT
+  {
+    return ptr;
+  }
+  throw std::bad_alloc();
+}
+
+auto operator delete(void* ptr) noexcept -> void { std::free(ptr); }  // NOLINT
+
+auto operator delete(void* ptr, std::size_t /*unused*/) noexcept -> void
+{
+  std::free(ptr);  // NOLINT
+}
+
+namespace
+{
+auto local(Arena& arena, Symbol name) -> Expression
+{
+  Value::Builder builder(arena);
+  builder.set_local(name);
+  return {arena, builder.build()};
+}
+
+auto constant(Arena& arena, int64_t value) -> Expression
+{
+  Value::Builder builder(arena);
+  builder.set_constant(value);
+  return {arena, builder.build()};
+}
+
+auto constant(Arena& arena, double value) -> Expression
+{
+  Value::Builder builder(arena);
+  builder.set_constant(value);
+  return {arena, builder.build()};
+}
+
+auto add(Arena& arena, Expression a, Expression b) -> Expression
+{
+  Operator::Builder builder(arena);
+  builder.set_type(Operator::Type::Add);
+  builder.set_a(std::move(a));
+  builder.set_b(std::move(b));
+  return {arena, builder.build()};
+}
+
+/// Mirrors the synthetic program of the lexer benchmark:
+///   let value_i = value_(i / 2) + i
+///   print value_i + 12190.5
+auto build(Arena& arena, std::vector<Symbol> const& names) -> Program
+{
+  Program program(arena);
+  for (auto i = 0; i < SyntheticLines; ++i)
+  {
+    Instruction::Builder binding(arena);
+    binding.binding.set_variable(names[i]);
+    binding.binding.set_expression(
+        add(arena, local(arena, names[i / 2]), constant(arena, int64_t{i})));
+    program.add_instruction(binding.build());
+
+    Instruction::Builder print(arena);
+    print.print.set_expression(add(arena, local(arena, names[i]), constant(arena, 12190.5)));
+    program.add_instruction(print.build());
+  }
+  return program;
+}
+}  // namespace
+
+auto main() -> int
+{
+  Interner interner;
+  std::vector<Symbol> names;
+  names.reserve(SyntheticLines);
+  for (auto i = 0; i < SyntheticLines; ++i)
+  {
+    names.push_back(interner.intern("value_" + std::to_string(i)));
+  }
+
+  std::chrono::duration<double> building{};
+  std::chrono::duration<double> releasing{};
+  std::size_t allocations = 0;
+  std::size_t instructions = 0;
+  std::size_t arenaBytes = 0;
+  for (auto i = 0; i < Iterations; ++i)
+  {
+    auto start = std::chrono::steady_clock::now();
+    auto initialAllocations = heapAllocations;
+    auto arena = std::make_unique<Arena>();
+    {
+      auto program = build(*arena, names);
+      allocations += heapAllocations - initialAllocations;
+      instructions += program.instructions().size();
+      arenaBytes += arena->bytes_allocated();
+      building += std::chrono::steady_clock::now() - start;
+
+      start = std::chrono::steady_clock::now();
+    }
+    arena.reset();
+    releasing += std::chrono::steady_clock::now() - start;
+  }
+
+  std::cout << "instructions: " << instructions / Iterations << std::endl;
+  std::cout << "heap allocations per instruction: "
+            << static_cast<double>(allocations) / static_cast<double>(instructions) << std::endl;
+  std::cout << "arena bytes per instruction: "
+            << static_cast<double>(arenaBytes) / static_cast<double>(instructions) << std::endl;
+  std::cout << "build: " << building.count() * 1000 / Iterations << " ms" << std::endl;
+  std::cout << "release: " << releasing.count() * 1000 / Iterations << " ms" << std::endl;
+}
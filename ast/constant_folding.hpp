@@ -0,0 +1,32 @@
+#pragma once
+
+#include <cstddef>
+
+#include "ast/arena.hpp"
+#include "ast/expression.hpp"
+#include "ast/program.hpp"
+
+namespace jackal::ast
+{
+/// @brief Folds the constant arithmetic of @p expression in place.
+///
+/// A chain of additions is flattened into its terms, however it is nested, and rebuilt as a
+/// left-nested chain, the order in which C evaluates it. When every constant in the chain is an
+/// integer, addition is associative and the constants are reassociated into a single sum that
+/// follows the variables, which is dropped if it is zero; integer sums wrap on overflow. Double
+/// addition is not associative, so a chain with a double constant only has its leading run of
+/// constants folded, using C's promotion of integer operands to double.
+///
+/// Chains that cannot be simplified are left untouched. Replacement nodes are allocated from
+/// @p arena, which must be the arena that owns @p expression.
+///
+/// @returns the number of operators removed
+std::size_t fold_constants(Arena& arena, Expression& expression) noexcept;
+
+/// @brief Folds the constant arithmetic of every expression in @p program in place.
+///
+/// @see fold_constants(Arena&, Expression&)
+///
+/// @returns the number of operators removed
+std::size_t fold_constants(Arena& arena, Program& program) noexcept;
+}  // namespace jackal::ast
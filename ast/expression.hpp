@@ -3,12 +3,13 @@
 #include <cassert>
 #include <memory>
 #include <optional>
-#include <string_view>
 #include <variant>
 
+#include "ast/arena.hpp"
 #include "ast/builder.hpp"
 #include "ast/node.hpp"
 #include "ast/visitor.hpp"
+#include "util/interner.hpp"
 
 // clang-format off
 namespace jackal::ast { struct LocalVariable; }
@@ -22,7 +23,7 @@ struct Expression : public AbstractSyntaxNode
 {
   struct Builder : public AstBuilder
   {
-    Builder() noexcept;
+    explicit Builder(Arena& arena) noexcept;
     ~Builder() noexcept;
     Builder(Builder const&) = delete;
     Builder& operator=(Builder const&) = delete;
@@ -35,11 +36,12 @@ struct Expression : public AbstractSyntaxNode
 
    private:
     struct Impl;
-    std::unique_ptr<Impl> _impl;
+    Arena& _arena;
+    ArenaPtr<Impl> _impl;
   };
 
-  explicit Expression(Operator op);
-  explicit Expression(Value value);
+  Expression(Arena& arena, Operator op) noexcept;
+  Expression(Arena& arena, Value value) noexcept;
 
   ~Expression() override;
   Expression(Expression const&) = delete;
@@ -58,32 +60,28 @@ struct Expression : public AbstractSyntaxNode
 
  private:
   struct Impl;
-  std::unique_ptr<Impl> _impl;
+  ArenaPtr<Impl> _impl;
 };
 
 struct Binding : public AbstractSyntaxNode
 {
   struct Builder : public AstBuilder
   {
-    Builder() noexcept;
-    ~Builder() noexcept;
-    Builder(Builder const&) = delete;
-    Builder& operator=(Builder const&) = delete;
-    Builder(Builder&&) noexcept = delete;
-    Builder& operator=(Builder&&) noexcept = delete;
+    explicit Builder(Arena& arena) noexcept : _arena(arena) {}
 
-    Builder& set_variable(std::string_view name) noexcept;
+    Builder& set_variable(util::Symbol name) noexcept;
 
     Builder& set_expression(Expression expr) noexcept;
 
     [[nodiscard]] Binding build() noexcept;
 
    private:
-    struct Impl;
-    std::unique_ptr<Impl> _impl;
+    Arena& _arena;
+    std::optional<util::Symbol> _variable;
+    std::optional<Expression> _expr;
   };
 
-  Binding(LocalVariable variable, Expression expr) noexcept;
+  Binding(Arena& arena, LocalVariable variable, Expression expr) noexcept;
 
   ~Binding() override;
   Binding(Binding const&) = delete;
@@ -101,13 +99,15 @@ struct Binding : public AbstractSyntaxNode
 
  private:
   struct Impl;
-  std::unique_ptr<Impl> _impl;
+  ArenaPtr<Impl> _impl;
 };
 
 struct Print : public AbstractSyntaxNode
 {
   struct Builder : public AstBuilder
   {
+    explicit Builder(Arena& arena) noexcept : _arena(arena) {}
+
     Builder& set_expression(Expression expr) noexcept
     {
       modified();
@@ -115,13 +115,14 @@ struct Print : public AbstractSyntaxNode
       return *this;
     }
 
-    [[nodiscard]] Print build() noexcept { return Print(std::move(_expr.value())); }
+    [[nodiscard]] Print build() noexcept { return {_arena, std::move(_expr.value())}; }
 
    private:
+    Arena& _arena;
     std::optional<Expression> _expr;
   };
 
-  explicit Print(Expression expr) noexcept;
+  Print(Arena& arena, Expression expr) noexcept;
 
   ~Print() override;
   Print(Print const&) = delete;
@@ -136,6 +137,6 @@ struct Print : public AbstractSyntaxNode
 
  private:
   struct Impl;
-  std::unique_ptr<Impl> _impl;
+  ArenaPtr<Impl> _impl;
 };
 }  // namespace jackal::ast
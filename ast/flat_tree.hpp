@@ -0,0 +1,130 @@
+#pragma once
+
+#include <cassert>
+#include <cstdint>
+#include <vector>
+
+#include "ast/operator.hpp"
+#include "util/interner.hpp"
+
+// clang-format off
+namespace jackal::ast { struct FlatVisitor; }
+// clang-format on
+
+namespace jackal::ast
+{
+/// @brief A syntax tree encoded as parallel arrays indexed by node.
+///
+/// Nodes are appended bottom-up, so every node is stored after its children and the arrays read
+/// in index order form a post-order traversal of each instruction. Each node occupies one entry in
+/// three hot columns: its kind and two operands. An operand is the id of a child node, a Symbol,
+/// or an index into one of the payload columns, depending on the node's kind:
+///
+///   Kind      a                    b
+///   Integer   index into integers  -
+///   Double    index into doubles   -
+///   Local     symbol of the name   -
+///   Add       left operand node    right operand node
+///   Binding   symbol of the name   expression node
+///   Print     expression node      -
+///
+/// Instructions are additionally recorded in source order.
+struct FlatTree
+{
+  enum class Kind : uint8_t
+  {
+    Integer,
+    Double,
+    Local,
+    Add,
+    Binding,
+    Print
+  };
+
+  using NodeId = uint32_t;
+
+  NodeId add_integer(int64_t value) noexcept;
+  NodeId add_double(double value) noexcept;
+  NodeId add_local(util::Symbol name) noexcept;
+  NodeId add_operator(Operator::Type type, NodeId a, NodeId b) noexcept;
+
+  /// @brief Appends a binding instruction. The expression must have been added already.
+  NodeId add_binding(util::Symbol variable, NodeId expr) noexcept;
+
+  /// @brief Appends a print instruction. The expression must have been added already.
+  NodeId add_print(NodeId expr) noexcept;
+
+  /// @brief Walks every instruction in source order, visiting expressions in source order.
+  void accept(FlatVisitor& visitor) const noexcept;
+
+  [[nodiscard]] std::size_t size() const noexcept { return _kinds.size(); }
+
+  [[nodiscard]] Kind kind(NodeId node) const noexcept { return _kinds[node]; }
+
+  [[nodiscard]] NodeId a(NodeId node) const noexcept { return _a[node]; }
+
+  [[nodiscard]] NodeId b(NodeId node) const noexcept { return _b[node]; }
+
+  [[nodiscard]] int64_t integer(NodeId node) const noexcept
+  {
+    assert(kind(node) == Kind::Integer);
+    return _integers[_a[node]];
+  }
+
+  [[nodiscard]] double floating(NodeId node) const noexcept
+  {
+    assert(kind(node) == Kind::Double);
+    return _doubles[_a[node]];
+  }
+
+  /// @returns the name of a Local or the variable bound by a Binding
+  [[nodiscard]] util::Symbol name(NodeId node) const noexcept
+  {
+    assert(kind(node) == Kind::Local || kind(node) == Kind::Binding);
+    return util::Symbol(_a[node]);
+  }
+
+  /// @returns the expression of a Binding or Print
+  [[nodiscard]] NodeId expression(NodeId node) const noexcept
+  {
+    assert(kind(node) == Kind::Binding || kind(node) == Kind::Print);
+    return kind(node) == Kind::Binding ? _b[node] : _a[node];
+  }
+
+  [[nodiscard]] std::vector<NodeId> const& instructions() const noexcept { return _instructions; }
+
+ private:
+  NodeId append(Kind kind, uint32_t a, uint32_t b) noexcept;
+
+ private:
+  std::vector<Kind> _kinds;
+  std::vector<uint32_t> _a;
+  std::vector<uint32_t> _b;
+
+  std::vector<int64_t> _integers;
+  std::vector<double> _doubles;
+
+  std::vector<NodeId> _instructions;
+};
+
+/// @brief Receives the nodes of a FlatTree in source order.
+///
+/// Instructions are bracketed by enter and leave calls; operators are visited between their
+/// operands, matching the order in which they appear in the source.
+struct FlatVisitor
+{
+  virtual ~FlatVisitor() = default;
+
+  virtual void enter_binding(util::Symbol variable) noexcept = 0;
+  virtual void leave_binding() noexcept = 0;
+
+  virtual void enter_print() noexcept = 0;
+  virtual void leave_print() noexcept = 0;
+
+  virtual void visit_operator(Operator::Type type) noexcept = 0;
+
+  virtual void visit_integer(int64_t value) noexcept = 0;
+  virtual void visit_double(double value) noexcept = 0;
+  virtual void visit_local(util::Symbol name) noexcept = 0;
+};
+}  // namespace jackal::ast
@@ -0,0 +1,67 @@
+#pragma once
+
+#include <cstddef>
+#include <limits>
+#include <vector>
+
+#include "ast/program.hpp"
+
+namespace jackal::ast
+{
+/// @brief The live range of every value bound by a Program, and an assignment of those values to
+/// as few local slots as possible.
+///
+/// Programs are straight-line, so a single backward pass over the instructions finds, for each
+/// Binding, the last instruction that reads the value it binds. A binding that is never read is
+/// dead, and the variables read by its expression do not count as used by it; a chain of bindings
+/// that only feed each other and never reach a Print is therefore dead as a whole.
+///
+/// Live values are then assigned slots by a linear scan in program order. An instruction reads its
+/// operands before it binds its result, so a slot freed by a value's last use can be reused by the
+/// value bound by that same instruction. Since every live range is an interval, the number of slots
+/// used is the most values live at once, which is the minimum any assignment can use.
+struct Liveness
+{
+  /// @brief Marks the last use and slot of values that are never read.
+  static constexpr std::size_t Dead = std::numeric_limits<std::size_t>::max();
+
+  explicit Liveness(Program const& program) noexcept;
+
+  /// @returns whether @p instruction is a Binding whose value is read by a later instruction
+  [[nodiscard]] bool live(std::size_t instruction) const noexcept
+  {
+    return _lastUse[instruction] != Dead;
+  }
+
+  /// @returns the index of the last instruction that reads the value bound by @p instruction, or
+  /// Dead if the value is never read or @p instruction is not a Binding
+  [[nodiscard]] std::size_t last_use(std::size_t instruction) const noexcept
+  {
+    return _lastUse[instruction];
+  }
+
+  /// @returns the local slot of the value bound by @p instruction, or Dead if it is not live
+  [[nodiscard]] std::size_t slot(std::size_t instruction) const noexcept
+  {
+    return _slots[instruction];
+  }
+
+  /// @returns the number of slots needed to hold every live value
+  [[nodiscard]] std::size_t local_count() const noexcept { return _localCount; }
+
+ private:
+  std::vector<std::size_t> _lastUse;
+  std::vector<std::size_t> _slots;
+  std::size_t _localCount = 0;
+};
+
+/// @brief Removes every dead Binding from @p program.
+///
+/// Expressions have no side effects, so removing a binding that is never read cannot change what
+/// the program prints.
+///
+/// @see Liveness
+///
+/// @returns the number of bindings removed
+std::size_t eliminate_dead_bindings(Program& program) noexcept;
+}  // namespace jackal::ast
@@ -3,14 +3,12 @@
 #include <memory>
 #include <optional>
 
+#include "ast/arena.hpp"
 #include "ast/builder.hpp"
+#include "ast/expression.hpp"
 #include "ast/node.hpp"
 #include "ast/visitor.hpp"
 
-// clang-format off
-namespace jackal::ast { struct Expression; }
-// clang-format on
-
 namespace jackal::ast
 {
 struct Operator : public AbstractSyntaxNode
@@ -22,12 +20,7 @@ struct Operator : public AbstractSyntaxNode
 
   struct Builder : public AstBuilder
   {
-    Builder() noexcept;
-    ~Builder() noexcept;
-    Builder(Builder const&) = delete;
-    Builder& operator=(Builder const&) = delete;
-    Builder(Builder&&) noexcept = delete;
-    Builder& operator=(Builder&&) noexcept = delete;
+    explicit Builder(Arena& arena) noexcept : _arena(arena) {}
 
     Builder& set_type(Type type) noexcept;
 
@@ -38,11 +31,13 @@ struct Operator : public AbstractSyntaxNode
     [[nodiscard]] Operator build() noexcept;
 
    private:
-    struct Impl;
-    std::unique_ptr<Impl> _impl;
+    Arena& _arena;
+    std::optional<Type> _type;
+    std::optional<Expression> _a;
+    std::optional<Expression> _b;
   };
 
-  Operator(Type type, Expression a, Expression b) noexcept;
+  Operator(Arena& arena, Type type, Expression a, Expression b) noexcept;
 
   ~Operator() override;
   Operator(Operator const&) = delete;
@@ -62,6 +57,6 @@ struct Operator : public AbstractSyntaxNode
 
  private:
   struct Impl;
-  std::unique_ptr<Impl> _impl;
+  ArenaPtr<Impl> _impl;
 };
 }  // namespace jackal::ast
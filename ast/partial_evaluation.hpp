@@ -0,0 +1,33 @@
+#pragma once
+
+#include <cstdint>
+#include <optional>
+#include <string>
+#include <vector>
+
+#include "ast/program.hpp"
+
+namespace jackal::ast
+{
+/// @brief What is known about the values of a Program before it runs.
+struct PartialEvaluation
+{
+  /// @brief The value of each instruction of the program, in order, where it is known: the value
+  /// stored by a Binding, or the value printed by a Print.
+  std::vector<std::optional<int64_t>> values;
+
+  /// @brief Everything the program prints, if every Print has a known value.
+  std::optional<std::string> output;
+};
+
+/// @brief Evaluates as much of @p program as can be computed without running it.
+///
+/// Values follow the C backend, which stores variables as int and prints them with %d. A binding
+/// is known when its expression is, with doubles truncated toward zero, and its value is
+/// propagated to every later reference to the variable. A print is known when its expression is
+/// an integer. Values that do not fit in an int, and variables referenced before they are bound,
+/// are left to be computed at run time.
+///
+/// Programs have no inputs, so everything is known unless one of those cases arises.
+[[nodiscard]] PartialEvaluation partially_evaluate(Program const& program) noexcept;
+}  // namespace jackal::ast
@@ -4,6 +4,7 @@
 #include <variant>
 #include <vector>
 
+#include "ast/arena.hpp"
 #include "ast/expression.hpp"
 
 namespace jackal::ast
@@ -12,6 +13,8 @@ struct Instruction : public AbstractSyntaxNode
 {
   struct Builder
   {
+    explicit Builder(Arena& arena) noexcept : binding(arena), print(arena), _arena(arena) {}
+
     Binding::Builder binding;
     Print::Builder print;
 
@@ -25,15 +28,18 @@ struct Instruction : public AbstractSyntaxNode
       assert(binding.was_modified() ^ print.was_modified());
       if (binding.was_modified())
       {
-        return Instruction(binding.build());
+        return {_arena, binding.build()};
       }
 
-      return Instruction(print.build());
+      return {_arena, print.build()};
     }
+
+   private:
+    Arena& _arena;
   };
 
-  explicit Instruction(Binding binding) noexcept;
-  explicit Instruction(Print print) noexcept;
+  Instruction(Arena& arena, Binding binding) noexcept;
+  Instruction(Arena& arena, Print print) noexcept;
 
   ~Instruction() override;
   Instruction(Instruction const&) = delete;
@@ -52,12 +58,15 @@ struct Instruction : public AbstractSyntaxNode
 
  private:
   struct Impl;
-  std::unique_ptr<Impl> _impl;
+  ArenaPtr<Impl> _impl;
 };
 
 struct Program : public AbstractSyntaxNode
 {
-  Program() noexcept;
+  /// @brief Instructions are stored in the Program's Arena alongside the nodes they refer to.
+  using Instructions = std::vector<Instruction, ArenaAllocator<Instruction>>;
+
+  explicit Program(Arena& arena) noexcept;
 
   ~Program() override;
   Program(Program const&) = delete;
@@ -69,11 +78,11 @@ struct Program : public AbstractSyntaxNode
 
   void add_instruction(Instruction instr) noexcept;
 
-  [[nodiscard]] std::vector<Instruction>& instructions() noexcept;
-  [[nodiscard]] std::vector<Instruction> const& instructions() const noexcept;
+  [[nodiscard]] Instructions& instructions() noexcept;
+  [[nodiscard]] Instructions const& instructions() const noexcept;
 
  private:
   struct Impl;
-  std::unique_ptr<Impl> _impl;
+  ArenaPtr<Impl> _impl;
 };
 }  // namespace jackal::ast
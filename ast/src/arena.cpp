@@ -0,0 +1,23 @@
+#include "ast/arena.hpp"
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+
+using jackal::ast::Arena;
+
+auto Arena::allocate_block(std::size_t size, std::size_t alignment) noexcept -> void*
+{
+  // Oversized requests receive a dedicated block large enough to satisfy their alignment
+  auto blockSize = std::max(_blockSize, size + alignment - 1);
+  _blocks.emplace_back(std::make_unique_for_overwrite<std::byte[]>(blockSize));  // NOLINT
+  _cursor = _blocks.back().get();
+  _end = _cursor + blockSize;
+
+  auto cursor = reinterpret_cast<std::uintptr_t>(_cursor);  // NOLINT
+  auto aligned = (cursor + alignment - 1) & ~(alignment - 1);
+  _cursor = reinterpret_cast<std::byte*>(aligned + size);  // NOLINT
+  _bytesAllocated += size;
+  return reinterpret_cast<void*>(aligned);  // NOLINT
+}
@@ -0,0 +1,70 @@
+#pragma once
+
+#include <cstdint>
+#include <type_traits>
+#include <variant>
+#include <vector>
+
+#include "ast/expression.hpp"
+#include "ast/operator.hpp"
+#include "ast/value.hpp"
+
+/// Arithmetic on constant values shared by the passes that compute them ahead of run time.
+namespace jackal::ast::arithmetic
+{
+using Numeric = std::variant<int64_t, double>;
+
+/// @brief Collects the terms of the chain of additions rooted at @p root, left to right.
+///
+/// An explicit stack keeps arbitrarily deep chains off the native stack.
+///
+/// @tparam Op Operator or Operator const, deciding the constness of the returned terms
+template <typename Op>
+auto terms(Op& root) -> std::vector<std::conditional_t<std::is_const_v<Op>, Value const, Value>*>
+{
+  using Term = std::conditional_t<std::is_const_v<Op>, Value const, Value>;
+  using Child = std::conditional_t<std::is_const_v<Op>, Expression const, Expression>;
+
+  std::vector<Term*> values;
+  std::vector<Child*> stack{&root.b(), &root.a()};
+  while (!stack.empty())
+  {
+    auto* expression = stack.back();
+    stack.pop_back();
+    // Add is the only operator, so every operator belongs to the chain
+    if (auto* op = std::get_if<Operator>(&expression->expression()))
+    {
+      stack.push_back(&op->b());
+      stack.push_back(&op->a());
+    }
+    else
+    {
+      values.push_back(&std::get<Value>(expression->expression()));
+    }
+  }
+  return values;
+}
+
+/// @returns the value of @p value if it is a constant, and nullptr otherwise
+inline auto constant(Value const& value) -> Numeric const*
+{
+  auto const* constant = std::get_if<Constant>(&value.value());
+  return constant != nullptr ? &constant->constant() : nullptr;
+}
+
+/// @brief Adds two constants as C does: integers wrap on overflow, and an integer added to a
+/// double is promoted to double.
+inline auto add(Numeric const& a, Numeric const& b) -> Numeric
+{
+  if (auto const* x = std::get_if<int64_t>(&a))
+  {
+    if (auto const* y = std::get_if<int64_t>(&b))
+    {
+      return static_cast<int64_t>(static_cast<uint64_t>(*x) + static_cast<uint64_t>(*y));
+    }
+  }
+
+  auto toDouble = [](auto number) { return static_cast<double>(number); };
+  return std::visit(toDouble, a) + std::visit(toDouble, b);
+}
+}  // namespace jackal::ast::arithmetic
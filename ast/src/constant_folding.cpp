@@ -0,0 +1,121 @@
+#include "ast/constant_folding.hpp"
+
+#include <variant>
+#include <vector>
+
+#include "ast/operator.hpp"
+#include "ast/src/arithmetic.hpp"
+#include "ast/value.hpp"
+
+using jackal::ast::Arena;
+using jackal::ast::Constant;
+using jackal::ast::Expression;
+using jackal::ast::Operator;
+using jackal::ast::Program;
+using jackal::ast::Value;
+
+namespace
+{
+using jackal::ast::arithmetic::add;
+using jackal::ast::arithmetic::constant;
+using jackal::ast::arithmetic::Numeric;
+using jackal::ast::arithmetic::terms;
+
+auto make_value(Arena& arena, Numeric const& number) -> Value
+{
+  return std::visit([&arena](auto constant) { return Value(arena, Constant(arena, constant)); },
+                    number);
+}
+}  // namespace
+
+auto jackal::ast::fold_constants(Arena& arena, Expression& expression) noexcept -> std::size_t
+{
+  auto* root = std::get_if<Operator>(&expression.expression());
+  if (root == nullptr)
+  {
+    return 0;
+  }
+
+  auto chain = terms(*root);
+  std::vector<Value> folded;
+
+  std::size_t constants = 0;
+  bool integral = true;
+  Numeric sum = int64_t{0};
+  for (auto const* term : chain)
+  {
+    if (auto const* number = constant(*term))
+    {
+      ++constants;
+      integral = integral && std::holds_alternative<int64_t>(*number);
+      sum = add(sum, *number);
+    }
+  }
+
+  if (integral)
+  {
+    // Integer addition is associative, so every constant can be summed into one trailing term
+    auto variables = chain.size() - constants;
+    bool keepSum = constants > 0 && (std::get<int64_t>(sum) != 0 || variables == 0);
+    if (variables + (keepSum ? 1 : 0) == chain.size())
+    {
+      return 0;
+    }
+
+    for (auto* term : chain)
+    {
+      if (constant(*term) == nullptr)
+      {
+        folded.push_back(std::move(*term));
+      }
+    }
+    if (keepSum)
+    {
+      folded.push_back(make_value(arena, sum));
+    }
+  }
+  else
+  {
+    // Reordering double additions changes their rounding; only the leading constants are folded
+    std::size_t leading = 0;
+    while (leading < chain.size() && constant(*chain[leading]) != nullptr)
+    {
+      ++leading;
+    }
+    if (leading < 2)
+    {
+      return 0;
+    }
+
+    Numeric prefix = *constant(*chain[0]);
+    for (std::size_t i = 1; i < leading; ++i)
+    {
+      prefix = add(prefix, *constant(*chain[i]));
+    }
+    folded.push_back(make_value(arena, prefix));
+    for (std::size_t i = leading; i < chain.size(); ++i)
+    {
+      folded.push_back(std::move(*chain[i]));
+    }
+  }
+
+  Expression result(arena, std::move(folded.front()));
+  for (std::size_t i = 1; i < folded.size(); ++i)
+  {
+    result = Expression(arena, Operator(arena, Operator::Type::Add, std::move(result),
+                                        Expression(arena, std::move(folded[i]))));
+  }
+  expression = std::move(result);
+  return chain.size() - folded.size();
+}
+
+auto jackal::ast::fold_constants(Arena& arena, Program& program) noexcept -> std::size_t
+{
+  std::size_t removed = 0;
+  for (auto& instruction : program.instructions())
+  {
+    removed += std::visit([&arena](auto& node) { return fold_constants(arena, node.expression()); },
+                          instruction.instruction());
+  }
+  return removed;
+}
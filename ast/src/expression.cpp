@@ -3,6 +3,7 @@
 #include <memory>
 #include <variant>
 
+#include "ast/arena.hpp"
 #include "ast/operator.hpp"
 #include "ast/value.hpp"
 
@@ -15,7 +16,7 @@ struct Expression::Builder::Impl
   std::variant<std::monostate, Operator, Value> expr;
 };
 
-Expression::Builder::Builder() noexcept : _impl(std::make_unique<Impl>()) {}
+Expression::Builder::Builder(Arena& arena) noexcept : _arena(arena), _impl(arena.make<Impl>()) {}
 
 Expression::Builder::~Builder() noexcept = default;
 
@@ -26,11 +27,11 @@ auto Expression::Builder::build() noexcept -> Expression
   assert(was_modified());
   if (auto* op = std::get_if<Operator>(&_impl->expr))
   {
-    return Expression(std::move(*op));
+    return {_arena, std::move(*op)};
   }
   if (auto* val = std::get_if<Value>(&_impl->expr))
   {
-    return Expression(std::move(*val));
+    return {_arena, std::move(*val)};
   }
 
   std::terminate();
@@ -41,9 +42,15 @@ struct Expression::Impl
   std::variant<Operator, Value> expr;
 };
 
-Expression::Expression(Operator op) : _impl(std::make_unique<Impl>(Impl{std::move(op)})) {}
+Expression::Expression(Arena& arena, Operator op) noexcept
+    : _impl(arena.make<Impl>(Impl{std::move(op)}))
+{
+}
 
-Expression::Expression(Value value) : _impl(std::make_unique<Impl>(Impl{std::move(value)})) {}
+Expression::Expression(Arena& arena, Value value) noexcept
+    : _impl(arena.make<Impl>(Impl{std::move(value)}))
+{
+}
 
 Expression::~Expression() = default;
 Expression::Expression(Expression&&) noexcept = default;
@@ -66,33 +73,23 @@ auto Expression::expression() const noexcept -> std::variant<Operator, Value> co
   return _impl->expr;
 }
 
-struct Binding::Builder::Impl
-{
-  std::optional<LocalVariable> variable;
-  std::optional<Expression> expr;
-};
-
-Binding::Builder::Builder() noexcept : _impl(std::make_unique<Impl>()) {}
-
-Binding::Builder::~Builder() noexcept = default;
-
-auto Binding::Builder::set_variable(std::string_view name) noexcept -> Builder&
+auto Binding::Builder::set_variable(util::Symbol name) noexcept -> Builder&
 {
   modified();
-  _impl->variable = LocalVariable(name);
+  _variable = name;
   return *this;
 }
 
 auto Binding::Builder::set_expression(Expression expr) noexcept -> Builder&
 {
   modified();
-  _impl->expr = std::move(expr);
+  _expr = std::move(expr);
   return *this;
 }
 
 auto Binding::Builder::build() noexcept -> Binding
 {
-  return {std::move(_impl->variable.value()), std::move(_impl->expr.value())};
+  return {_arena, LocalVariable(_arena, _variable.value()), std::move(_expr.value())};
 }
 
 struct Binding::Impl
@@ -101,8 +98,8 @@ struct Binding::Impl
   Expression expr;
 };
 
-Binding::Binding(LocalVariable variable, Expression expr) noexcept
-    : _impl(std::make_unique<Impl>(Impl{std::move(variable), std::move(expr)}))
+Binding::Binding(Arena& arena, LocalVariable variable, Expression expr) noexcept
+    : _impl(arena.make<Impl>(Impl{std::move(variable), std::move(expr)}))
 {
 }
 
@@ -121,7 +118,10 @@ struct Print::Impl
   Expression expr;
 };
 
-Print::Print(Expression expr) noexcept : _impl(std::make_unique<Impl>(Impl{std::move(expr)})) {}
+Print::Print(Arena& arena, Expression expr) noexcept
+    : _impl(arena.make<Impl>(Impl{std::move(expr)}))
+{
+}
 
 Print::~Print() = default;
 Print::Print(Print&&) noexcept = default;
@@ -0,0 +1,131 @@
+#include "ast/flat_tree.hpp"
+
+#include <cassert>
+#include <cstdint>
+#include <exception>
+#include <vector>
+
+using jackal::ast::FlatTree;
+
+namespace
+{
+/// An entry of the explicit traversal stack: either a subtree still to be walked, or an operator
+/// whose left operand has been visited and which must be reported before its right operand.
+struct Pending
+{
+  FlatTree::NodeId node;
+  bool infix;
+};
+}  // namespace
+
+auto FlatTree::append(Kind kind, uint32_t a, uint32_t b) noexcept -> NodeId
+{
+  auto node = static_cast<NodeId>(_kinds.size());
+  _kinds.push_back(kind);
+  _a.push_back(a);
+  _b.push_back(b);
+  return node;
+}
+
+auto FlatTree::add_integer(int64_t value) noexcept -> NodeId
+{
+  _integers.push_back(value);
+  return append(Kind::Integer, static_cast<uint32_t>(_integers.size() - 1), 0);
+}
+
+auto FlatTree::add_double(double value) noexcept -> NodeId
+{
+  _doubles.push_back(value);
+  return append(Kind::Double, static_cast<uint32_t>(_doubles.size() - 1), 0);
+}
+
+auto FlatTree::add_local(util::Symbol name) noexcept -> NodeId
+{
+  return append(Kind::Local, name.id(), 0);
+}
+
+auto FlatTree::add_operator(Operator::Type type, NodeId a, NodeId b) noexcept -> NodeId
+{
+  assert(a < size() && b < size());
+  switch (type)
+  {
+    case Operator::Type::Add:
+      return append(Kind::Add, a, b);
+  }
+
+  std::terminate();
+}
+
+auto FlatTree::add_binding(util::Symbol variable, NodeId expr) noexcept -> NodeId
+{
+  assert(expr < size());
+  auto node = append(Kind::Binding, variable.id(), expr);
+  _instructions.push_back(node);
+  return node;
+}
+
+auto FlatTree::add_print(NodeId expr) noexcept -> NodeId
+{
+  assert(expr < size());
+  auto node = append(Kind::Print, expr, 0);
+  _instructions.push_back(node);
+  return node;
+}
+
+auto FlatTree::accept(FlatVisitor& visitor) const noexcept -> void
+{
+  std::vector<Pending> stack;
+  for (auto instruction : _instructions)
+  {
+    if (kind(instruction) == Kind::Binding)
+    {
+      visitor.enter_binding(name(instruction));
+    }
+    else
+    {
+      visitor.enter_print();
+    }
+
+    stack.push_back({expression(instruction), false});
+    while (!stack.empty())
+    {
+      auto [node, infix] = stack.back();
+      stack.pop_back();
+      switch (kind(node))
+      {
+        case Kind::Integer:
+          visitor.visit_integer(integer(node));
+          break;
+        case Kind::Double:
+          visitor.visit_double(floating(node));
+          break;
+        case Kind::Local:
+          visitor.visit_local(name(node));
+          break;
+        case Kind::Add:
+          if (infix)
+          {
+            visitor.visit_operator(Operator::Type::Add);
+            break;
+          }
+          stack.push_back({_b[node], false});
+          stack.push_back({node, true});
+          stack.push_back({_a[node], false});
+          break;
+        case Kind::Binding:
+        case Kind::Print:
+          // Instructions are never nested within expressions
+          std::terminate();
+      }
+    }
+
+    if (kind(instruction) == Kind::Binding)
+    {
+      visitor.leave_binding();
+    }
+    else
+    {
+      visitor.leave_print();
+    }
+  }
+}
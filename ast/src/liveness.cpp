@@ -0,0 +1,140 @@
+#include "ast/liveness.hpp"
+
+#include <functional>
+#include <queue>
+#include <utility>
+#include <variant>
+
+#include "ast/expression.hpp"
+#include "ast/operator.hpp"
+#include "ast/src/arithmetic.hpp"
+#include "ast/value.hpp"
+
+using jackal::ast::Expression;
+using jackal::ast::Liveness;
+using jackal::ast::Program;
+
+namespace
+{
+/// Calls @p read with the name of every variable that @p expression reads
+template <typename Read>
+void for_each_read(Expression const& expression, Read&& read)
+{
+  auto term = [&read](jackal::ast::Value const& value)
+  {
+    if (auto const* local = std::get_if<jackal::ast::LocalVariable>(&value.value()))
+    {
+      read(local->name());
+    }
+  };
+
+  if (auto const* root = std::get_if<jackal::ast::Operator>(&expression.expression()))
+  {
+    for (auto const* value : jackal::ast::arithmetic::terms(*root))
+    {
+      term(*value);
+    }
+  }
+  else
+  {
+    term(expression.value_unsafe());
+  }
+}
+
+template <typename T>
+using MinQueue = std::priority_queue<T, std::vector<T>, std::greater<>>;
+}  // namespace
+
+Liveness::Liveness(Program const& program) noexcept
+    : _lastUse(program.instructions().size(), Dead), _slots(program.instructions().size(), Dead)
+{
+  auto const& instructions = program.instructions();
+
+  // Walking backward, the last read of each variable since it was most recently bound, indexed by
+  // Symbol id
+  std::vector<std::size_t> lastRead;
+  for (auto i = instructions.size(); i-- > 0;)
+  {
+    auto read = [&lastRead, i](util::Symbol name)
+    {
+      if (name.id() >= lastRead.size())
+      {
+        lastRead.resize(name.id() + 1, Dead);
+      }
+      if (lastRead[name.id()] == Dead)
+      {
+        lastRead[name.id()] = i;
+      }
+    };
+
+    auto const* binding = std::get_if<Binding>(&instructions[i].instruction());
+    if (binding == nullptr)
+    {
+      for_each_read(instructions[i].print_unsafe().expression(), read);
+      continue;
+    }
+
+    // The binding kills the variable before its own expression reads the previous value
+    auto name = binding->variable().name();
+    if (name.id() < lastRead.size())
+    {
+      _lastUse[i] = std::exchange(lastRead[name.id()], Dead);
+    }
+    if (_lastUse[i] != Dead)
+    {
+      for_each_read(binding->expression(), read);
+    }
+  }
+
+  // Values occupying a slot, ordered by their last use, and slots free for reuse
+  MinQueue<std::pair<std::size_t, std::size_t>> occupied;
+  MinQueue<std::size_t> free;
+  for (std::size_t i = 0; i < instructions.size(); ++i)
+  {
+    while (!occupied.empty() && occupied.top().first <= i)
+    {
+      free.push(occupied.top().second);
+      occupied.pop();
+    }
+
+    if (_lastUse[i] == Dead)
+    {
+      continue;
+    }
+
+    if (free.empty())
+    {
+      _slots[i] = _localCount++;
+    }
+    else
+    {
+      _slots[i] = free.top();
+      free.pop();
+    }
+    occupied.emplace(_lastUse[i], _slots[i]);
+  }
+}
+
+auto jackal::ast::eliminate_dead_bindings(Program& program) noexcept -> std::size_t
+{
+  Liveness liveness(program);
+  auto& instructions = program.instructions();
+
+  std::size_t kept = 0;
+  for (std::size_t i = 0; i < instructions.size(); ++i)
+  {
+    if (std::holds_alternative<Binding>(instructions[i].instruction()) && !liveness.live(i))
+    {
+      continue;
+    }
+    if (kept != i)
+    {
+      instructions[kept] = std::move(instructions[i]);
+    }
+    ++kept;
+  }
+
+  auto removed = instructions.size() - kept;
+  instructions.erase(instructions.begin() + static_cast<std::ptrdiff_t>(kept), instructions.end());
+  return removed;
+}
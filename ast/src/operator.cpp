@@ -2,44 +2,35 @@
 
 #include <memory>
 
+#include "ast/arena.hpp"
 #include "ast/expression.hpp"
 
 using jackal::ast::Operator;
 
-struct Operator::Builder::Impl
-{
-  std::optional<Type> type;
-  std::optional<Expression> a;
-  std::optional<Expression> b;
-};
-
-Operator::Builder::Builder() noexcept : _impl(std::make_unique<Impl>()) {}
-Operator::Builder::~Builder() noexcept = default;
-
 auto Operator::Builder::set_type(Type type) noexcept -> Builder&
 {
   modified();
-  _impl->type = type;
+  _type = type;
   return *this;
 }
 
 auto Operator::Builder::set_a(Expression a) noexcept -> Builder&
 {
   modified();
-  _impl->a = std::move(a);
+  _a = std::move(a);
   return *this;
 }
 
 auto Operator::Builder::set_b(Expression b) noexcept -> Builder&
 {
   modified();
-  _impl->b = std::move(b);
+  _b = std::move(b);
   return *this;
 }
 
 auto Operator::Builder::build() noexcept -> Operator
 {
-  return {_impl->type.value(), std::move(_impl->a.value()), std::move(_impl->b.value())};
+  return {_arena, _type.value(), std::move(_a.value()), std::move(_b.value())};
 }
 
 struct Operator::Impl
@@ -49,8 +40,8 @@ struct Operator::Impl
   Expression b;
 };
 
-Operator::Operator(Type type, Expression a, Expression b) noexcept
-    : _impl(std::make_unique<Impl>(Impl{type, std::move(a), std::move(b)}))
+Operator::Operator(Arena& arena, Type type, Expression a, Expression b) noexcept
+    : _impl(arena.make<Impl>(Impl{type, std::move(a), std::move(b)}))
 {
 }
 
@@ -0,0 +1,131 @@
+#include "ast/partial_evaluation.hpp"
+
+#include <cmath>
+#include <limits>
+#include <variant>
+
+#include "ast/expression.hpp"
+#include "ast/operator.hpp"
+#include "ast/src/arithmetic.hpp"
+#include "ast/value.hpp"
+
+using jackal::ast::Expression;
+using jackal::ast::PartialEvaluation;
+using jackal::ast::Program;
+
+namespace
+{
+using jackal::ast::arithmetic::Numeric;
+
+/// The known values of the variables bound so far, indexed by Symbol id
+using Environment = std::vector<std::optional<int64_t>>;
+
+auto lookup(Environment const& environment, jackal::util::Symbol name) -> std::optional<int64_t>
+{
+  return name.id() < environment.size() ? environment[name.id()] : std::nullopt;
+}
+
+auto evaluate(Expression const& expression, Environment const& environment)
+    -> std::optional<Numeric>
+{
+  auto term = [&environment](jackal::ast::Value const& value) -> std::optional<Numeric>
+  {
+    if (auto const* number = jackal::ast::arithmetic::constant(value))
+    {
+      return *number;
+    }
+    if (auto known = lookup(environment, value.local_variable_unsafe().name()))
+    {
+      return Numeric(*known);
+    }
+    return std::nullopt;
+  };
+
+  auto const* root = std::get_if<jackal::ast::Operator>(&expression.expression());
+  if (root == nullptr)
+  {
+    return term(expression.value_unsafe());
+  }
+
+  // C evaluates a chain of additions left to right, however the tree is nested
+  std::optional<Numeric> sum;
+  for (auto const* value : jackal::ast::arithmetic::terms(*root))
+  {
+    auto known = term(*value);
+    if (!known.has_value())
+    {
+      return std::nullopt;
+    }
+    sum = sum.has_value() ? jackal::ast::arithmetic::add(*sum, *known) : *known;
+  }
+  return sum;
+}
+
+/// @returns @p value if it is an int
+auto as_int(int64_t value) -> std::optional<int64_t>
+{
+  if (value < std::numeric_limits<int>::min() || value > std::numeric_limits<int>::max())
+  {
+    return std::nullopt;
+  }
+  return value;
+}
+
+/// @returns @p value converted to int as by assignment, if the conversion is defined
+auto as_int(Numeric const& value) -> std::optional<int64_t>
+{
+  if (auto const* integer = std::get_if<int64_t>(&value))
+  {
+    return as_int(*integer);
+  }
+
+  auto truncated = std::trunc(std::get<double>(value));
+  if (!(truncated >= std::numeric_limits<int>::min() &&
+        truncated <= std::numeric_limits<int>::max()))
+  {
+    return std::nullopt;
+  }
+  return static_cast<int64_t>(truncated);
+}
+}  // namespace
+
+auto jackal::ast::partially_evaluate(Program const& program) noexcept -> PartialEvaluation
+{
+  PartialEvaluation evaluation;
+  evaluation.values.reserve(program.instructions().size());
+  evaluation.output.emplace();
+
+  Environment environment;
+  for (auto const& instruction : program.instructions())
+  {
+    if (auto const* binding = std::get_if<Binding>(&instruction.instruction()))
+    {
+      auto value = evaluate(binding->expression(), environment);
+      auto known = value.has_value() ? as_int(*value) : std::nullopt;
+
+      auto name = binding->variable().name();
+      if (name.id() >= environment.size())
+      {
+        environment.resize(name.id() + 1);
+      }
+      environment[name.id()] = known;
+      evaluation.values.push_back(known);
+      continue;
+    }
+
+    // Printing a double with %d is undefined, so only integers are known
+    auto value = evaluate(instruction.print_unsafe().expression(), environment);
+    auto const* integer = value.has_value() ? std::get_if<int64_t>(&*value) : nullptr;
+    auto known = integer != nullptr ? as_int(*integer) : std::nullopt;
+    evaluation.values.push_back(known);
+    if (!known.has_value())
+    {
+      evaluation.output.reset();
+    }
+    else if (evaluation.output.has_value())
+    {
+      evaluation.output->append(std::to_string(*known)).push_back('\n');
+    }
+  }
+  return evaluation;
+}
@@ -2,6 +2,8 @@
 
 #include <memory>
 
+#include "ast/arena.hpp"
+
 using jackal::ast::Instruction;
 using jackal::ast::Program;
 
@@ -10,13 +12,13 @@ struct Instruction::Impl
   std::variant<Binding, Print> instruction;
 };
 
-Instruction::Instruction(Binding binding) noexcept
-    : _impl(std::make_unique<Impl>(Impl{std::move(binding)}))
+Instruction::Instruction(Arena& arena, Binding binding) noexcept
+    : _impl(arena.make<Impl>(Impl{std::move(binding)}))
 {
 }
 
-Instruction::Instruction(Print print) noexcept
-    : _impl(std::make_unique<Impl>(Impl{std::move(print)}))
+Instruction::Instruction(Arena& arena, Print print) noexcept
+    : _impl(arena.make<Impl>(Impl{std::move(print)}))
 {
 }
 
@@ -45,10 +47,13 @@ auto Instruction::instruction() const noexcept -> std::variant<Binding, Print> c
 
 struct Program::Impl
 {
-  std::vector<Instruction> instructions;
+  Instructions instructions;
 };
 
-Program::Program() noexcept : _impl(std::make_unique<Impl>()) {}
+Program::Program(Arena& arena) noexcept
+    : _impl(arena.make<Impl>(Impl{Instructions(ArenaAllocator<Instruction>(arena))}))
+{
+}
 
 Program::~Program() = default;
 Program::Program(Program&&) noexcept = default;
@@ -59,9 +64,9 @@ auto Program::add_instruction(Instruction instr) noexcept -> void
   _impl->instructions.emplace_back(std::move(instr));
 }
 
-auto Program::instructions() noexcept -> std::vector<Instruction>& { return _impl->instructions; }
+auto Program::instructions() noexcept -> Instructions& { return _impl->instructions; }
 
-auto Program::instructions() const noexcept -> std::vector<Instruction> const&
+auto Program::instructions() const noexcept -> Instructions const&
 {
   return _impl->instructions;
 }
@@ -0,0 +1,57 @@
+#include "ast/traversal.hpp"
+
+#include <variant>
+#include <vector>
+
+#include "ast/operator.hpp"
+#include "ast/value.hpp"
+
+using jackal::ast::Expression;
+using jackal::ast::WalkOrder;
+
+namespace
+{
+/// An entry of the worklist: either an expression still to be walked, or an operator whose operands
+/// have been scheduled and which must be reported when it is reached again.
+struct Pending
+{
+  Expression* expression;
+  bool expanded;
+};
+}  // namespace
+
+auto jackal::ast::walk(Expression& expression, Visitor& visitor, WalkOrder order) noexcept -> void
+{
+  std::vector<Pending> stack{{&expression, false}};
+  while (!stack.empty())
+  {
+    auto [next, expanded] = stack.back();
+    stack.pop_back();
+
+    auto* op = std::get_if<Operator>(&next->expression());
+    if (op == nullptr)
+    {
+      visitor.visit(std::get<Value>(next->expression()));
+      continue;
+    }
+    if (expanded)
+    {
+      visitor.visit(*op);
+      continue;
+    }
+
+    switch (order)
+    {
+      case WalkOrder::InOrder:
+        stack.push_back({&op->b(), false});
+        stack.push_back({next, true});
+        stack.push_back({&op->a(), false});
+        break;
+      case WalkOrder::PostOrder:
+        stack.push_back({next, true});
+        stack.push_back({&op->b(), false});
+        stack.push_back({&op->a(), false});
+        break;
+    }
+  }
+}
@@ -1,9 +1,10 @@
 #include "ast/value.hpp"
 
 #include <memory>
-#include <string_view>
 #include <variant>
 
+#include "ast/arena.hpp"
+
 using jackal::ast::Constant;
 using jackal::ast::LocalVariable;
 using jackal::ast::Value;
@@ -13,9 +14,15 @@ struct Constant::Impl
   std::variant<int64_t, double> constant;
 };
 
-Constant::Constant(int64_t constant) noexcept : _impl(std::make_unique<Impl>(Impl{constant})) {}
+Constant::Constant(Arena& arena, int64_t constant) noexcept
+    : _impl(arena.make<Impl>(Impl{constant}))
+{
+}
 
-Constant::Constant(double constant) noexcept : _impl(std::make_unique<Impl>(Impl{constant})) {}
+Constant::Constant(Arena& arena, double constant) noexcept
+    : _impl(arena.make<Impl>(Impl{constant}))
+{
+}
 
 Constant::~Constant() = default;
 Constant::Constant(Constant&&) noexcept = default;
@@ -37,11 +44,11 @@ auto Constant::constant() const noexcept -> std::variant<int64_t, double> const&
 
 struct LocalVariable::Impl
 {
-  std::string_view name;
+  util::Symbol name;
 };
 
-LocalVariable::LocalVariable(std::string_view name) noexcept
-    : _impl(std::make_unique<Impl>(Impl{name}))
+LocalVariable::LocalVariable(Arena& arena, util::Symbol name) noexcept
+    : _impl(arena.make<Impl>(Impl{name}))
 {
 }
 
@@ -49,18 +56,20 @@ LocalVariable::~LocalVariable() = default;
 LocalVariable::LocalVariable(LocalVariable&&) noexcept = default;
 LocalVariable& LocalVariable::operator=(LocalVariable&&) noexcept = default;
 
-auto LocalVariable::name() const noexcept -> std::string_view { return _impl->name; }
+auto LocalVariable::name() const noexcept -> util::Symbol { return _impl->name; }
 
 struct Value::Impl
 {
   std::variant<Constant, LocalVariable> value;
 };
 
-Value::Value(Constant constant) noexcept : _impl(std::make_unique<Impl>(Impl{std::move(constant)}))
+Value::Value(Arena& arena, Constant constant) noexcept
+    : _impl(arena.make<Impl>(Impl{std::move(constant)}))
 {
 }
 
-Value::Value(LocalVariable local) noexcept : _impl(std::make_unique<Impl>(Impl{std::move(local)}))
+Value::Value(Arena& arena, LocalVariable local) noexcept
+    : _impl(arena.make<Impl>(Impl{std::move(local)}))
 {
 }
 
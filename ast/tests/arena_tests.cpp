@@ -0,0 +1,95 @@
+#include "tests/catch.hpp"
+
+#include <cstdint>
+#include <vector>
+
+#include "ast/arena.hpp"
+#include "ast/expression.hpp"
+#include "ast/operator.hpp"
+#include "ast/program.hpp"
+#include "ast/value.hpp"
+#include "util/interner.hpp"
+
+using jackal::ast::Arena;
+using jackal::ast::ArenaAllocator;
+
+TEST_CASE("Arena allocations should respect the requested alignment", "[ast][arena]")
+{
+  Arena arena;
+  for (std::size_t alignment : {1, 2, 4, 8, 16, 64})
+  {
+    static_cast<void>(arena.allocate(1, 1));
+    auto address = reinterpret_cast<std::uintptr_t>(arena.allocate(3, alignment));
+    REQUIRE(address % alignment == 0);
+  }
+}
+
+TEST_CASE("Arena should request new blocks only when the current block is exhausted",
+          "[ast][arena]")
+{
+  Arena arena(64);
+  REQUIRE(arena.block_count() == 0);
+
+  auto* first = static_cast<char*>(arena.allocate(32, 1));
+  auto* second = static_cast<char*>(arena.allocate(32, 1));
+  REQUIRE(arena.block_count() == 1);
+  REQUIRE(second == first + 32);
+
+  static_cast<void>(arena.allocate(1, 1));
+  REQUIRE(arena.block_count() == 2);
+  REQUIRE(arena.bytes_allocated() == 65);
+}
+
+TEST_CASE("Arena should satisfy allocations larger than its block size", "[ast][arena]")
+{
+  Arena arena(64);
+  auto* large = static_cast<char*>(arena.allocate(1024, 16));
+  large[0] = 'a';
+  large[1023] = 'z';  // NOLINT
+  REQUIRE(reinterpret_cast<std::uintptr_t>(large) % 16 == 0);
+  REQUIRE(arena.bytes_allocated() == 1024);
+}
+
+TEST_CASE("ArenaAllocator should back standard containers", "[ast][arena]")
+{
+  Arena arena(128);
+  std::vector<int64_t, ArenaAllocator<int64_t>> values{ArenaAllocator<int64_t>(arena)};
+  for (int64_t i = 0; i < 1000; ++i)
+  {
+    values.push_back(i);
+  }
+
+  REQUIRE(values.size() == 1000);
+  REQUIRE(values.front() == 0);
+  REQUIRE(values.back() == 999);
+  REQUIRE(arena.block_count() > 1);
+}
+
+TEST_CASE("Syntax trees should be allocated from their Arena", "[ast][arena]")
+{
+  Arena arena;
+  jackal::util::Interner interner;
+
+  jackal::ast::Value::Builder a(arena);
+  a.set_local(interner.intern("x"));
+  jackal::ast::Value::Builder b(arena);
+  b.set_constant(int64_t{2});
+
+  jackal::ast::Operator::Builder op(arena);
+  op.set_type(jackal::ast::Operator::Type::Add);
+  op.set_a(jackal::ast::Expression(arena, a.build()));
+  op.set_b(jackal::ast::Expression(arena, b.build()));
+
+  jackal::ast::Instruction::Builder instruction(arena);
+  instruction.print.set_expression(jackal::ast::Expression(arena, op.build()));
+
+  jackal::ast::Program program(arena);
+  program.add_instruction(instruction.build());
+  REQUIRE(arena.bytes_allocated() > 0);
+
+  auto const& print = program.instructions().at(0).print_unsafe();
+  REQUIRE(print.expression().operator_unsafe().a().value_unsafe().local_variable_unsafe().name() ==
+          interner.intern("x"));
+  REQUIRE(print.expression().operator_unsafe().b().value_unsafe().constant_unsafe().int_unsafe() ==
+          2);
+}
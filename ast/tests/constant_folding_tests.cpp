@@ -0,0 +1,140 @@
+#include "tests/catch.hpp"
+
+#include <cstdint>
+#include <limits>
+#include <string>
+#include <variant>
+
+#include "ast/constant_folding.hpp"
+#include "ast/expression.hpp"
+#include "ast/operator.hpp"
+#include "ast/partial_evaluation.hpp"
+#include "ast/program.hpp"
+#include "ast/tests/expressions.hpp"
+#include "ast/value.hpp"
+
+using jackal::ast::Constant;
+using jackal::ast::fold_constants;
+using jackal::ast::Operator;
+using jackal::ast::partially_evaluate;
+using jackal::ast::Program;
+using jackal::ast::Value;
+using jackal::ast::tests::Expressions;
+
+TEST_CASE("Constant folding should fold additions of integer constants", "[ast][fold]")
+{
+  Expressions e;
+  auto expression = e.add(e.constant(int64_t{3}), e.constant(int64_t{4}));
+  REQUIRE(fold_constants(e.arena, expression) == 1);
+  REQUIRE(e.render(expression) == "7");
+  REQUIRE(std::get<int64_t>(
+              std::get<Constant>(std::get<Value>(expression.expression()).value()).constant()) ==
+          7);
+}
+
+TEST_CASE("Constant folding should reassociate integer constants past variables", "[ast][fold]")
+{
+  Expressions e;
+  // 1 + x + 2 + y + 3, nested to the left as the parser builds it
+  auto expression = e.add(
+      e.add(e.add(e.add(e.constant(int64_t{1}), e.local("x")), e.constant(int64_t{2})),
+            e.local("y")),
+      e.constant(int64_t{3}));
+  REQUIRE(fold_constants(e.arena, expression) == 2);
+  REQUIRE(e.render(expression) == "((x + y) + 6)");
+}
+
+TEST_CASE("Constant folding should drop constants that sum to zero", "[ast][fold]")
+{
+  Expressions e;
+  auto expression =
+      e.add(e.local("x"), e.add(e.constant(int64_t{5}), e.constant(int64_t{-5})));
+  REQUIRE(fold_constants(e.arena, expression) == 2);
+  REQUIRE(e.render(expression) == "x");
+
+  auto zero = e.add(e.constant(int64_t{5}), e.constant(int64_t{-5}));
+  REQUIRE(fold_constants(e.arena, zero) == 1);
+  REQUIRE(e.render(zero) == "0");
+}
+
+TEST_CASE("Constant folding should leave expressions without foldable constants", "[ast][fold]")
+{
+  Expressions e;
+  auto sum = e.add(e.local("x"), e.add(e.local("y"), e.constant(int64_t{1})));
+  REQUIRE(fold_constants(e.arena, sum) == 0);
+  REQUIRE(e.render(sum) == "(x + (y + 1))");
+
+  auto value = e.constant(int64_t{1});
+  REQUIRE(fold_constants(e.arena, value) == 0);
+  REQUIRE(e.render(value) == "1");
+}
+
+TEST_CASE("Constant folding should wrap integer sums on overflow", "[ast][fold]")
+{
+  Expressions e;
+  auto expression = e.add(e.constant(std::numeric_limits<int64_t>::max()), e.constant(int64_t{1}));
+  REQUIRE(fold_constants(e.arena, expression) == 1);
+  REQUIRE(e.render(expression) == std::to_string(std::numeric_limits<int64_t>::min()));
+}
+
+TEST_CASE("Constant folding should preserve the evaluation order of doubles", "[ast][fold]")
+{
+  Expressions e;
+  // 1 + 2.5 + x + 0.5: the integer is promoted, but 0.5 must still be added after x
+  auto expression = e.add(e.constant(int64_t{1}),
+                          e.add(e.constant(2.5), e.add(e.local("x"), e.constant(0.5))));
+  REQUIRE(fold_constants(e.arena, expression) == 1);
+  REQUIRE(e.render(expression) == "((3.5 + x) + 0.5)");
+  auto const& folded =
+      std::get<Operator>(std::get<Operator>(expression.expression()).a().expression()).a();
+  REQUIRE(std::holds_alternative<double>(
+      std::get<Constant>(std::get<Value>(folded.expression()).value()).constant()));
+
+  auto trailing = e.add(e.local("x"), e.add(e.constant(0.5), e.constant(0.5)));
+  REQUIRE(fold_constants(e.arena, trailing) == 0);
+}
+
+TEST_CASE("Constant folding should not change what a program with doubles prints", "[ast][fold]")
+{
+  Expressions e;
+  Program program(e.arena);
+  // let x = 0.4999996 + 0.4999996; print x: the exact sum 0.9999992 truncates to 0
+  program.add_instruction(e.let("x", e.add(e.constant(0.4999996), e.constant(0.4999996))));
+  program.add_instruction(e.print(e.local("x")));
+  REQUIRE(partially_evaluate(program).output == "0\n");
+
+  REQUIRE(fold_constants(e.arena, program) == 1);
+  auto const& sum = program.instructions()[0].binding_unsafe().expression();
+  auto const& folded = std::get<Constant>(std::get<Value>(sum.expression()).value());
+  REQUIRE(std::get<double>(folded.constant()) == 0.4999996 + 0.4999996);
+  REQUIRE(partially_evaluate(program).output == "0\n");
+}
+
+TEST_CASE("Constant folding should handle deeply nested chains", "[ast][fold]")
+{
+  constexpr auto Depth = 100000;
+
+  Expressions e;
+  auto expression = e.local("x");
+  for (auto i = 0; i < Depth; ++i)
+  {
+    expression = e.add(e.constant(int64_t{1}), std::move(expression));
+  }
+
+  REQUIRE(fold_constants(e.arena, expression) == Depth - 1);
+  REQUIRE(e.render(expression) == "(x + " + std::to_string(Depth) + ")");
+}
+
+TEST_CASE("Constant folding should fold every instruction of a program", "[ast][fold]")
+{
+  Expressions e;
+  Program program(e.arena);
+  program.add_instruction(e.let("a", e.add(e.constant(int64_t{3}), e.constant(int64_t{4}))));
+  program.add_instruction(
+      e.print(e.add(e.local("a"), e.add(e.constant(int64_t{1}), e.constant(int64_t{2})))));
+
+  REQUIRE(fold_constants(e.arena, program) == 2);
+  auto const& instructions = program.instructions();
+  REQUIRE(e.render(instructions[0].binding_unsafe().expression()) == "7");
+  REQUIRE(e.render(instructions[1].print_unsafe().expression()) == "(a + 3)");
+}
@@ -0,0 +1,67 @@
+#pragma once
+
+#include <sstream>
+#include <string>
+#include <string_view>
+#include <variant>
+
+#include "ast/arena.hpp"
+#include "ast/expression.hpp"
+#include "ast/operator.hpp"
+#include "ast/program.hpp"
+#include "ast/value.hpp"
+#include "util/interner.hpp"
+
+namespace jackal::ast::tests
+{
+/// @brief Builds syntax trees in a shared arena, interning variable names as they are used.
+struct Expressions
+{
+  template <typename T>
+  Expression constant(T value)
+  {
+    return {arena, Value(arena, Constant(arena, value))};
+  }
+
+  Expression floating(double value) { return constant(value); }
+
+  Expression local(std::string_view name)
+  {
+    return {arena, Value(arena, LocalVariable(arena, names.intern(name)))};
+  }
+
+  Expression add(Expression a, Expression b)
+  {
+    return {arena, Operator(arena, Operator::Type::Add, std::move(a), std::move(b))};
+  }
+
+  Instruction let(std::string_view name, Expression expression)
+  {
+    return {arena, Binding(arena, LocalVariable(arena, names.intern(name)), std::move(expression))};
+  }
+
+  Instruction print(Expression expression) { return {arena, Print(arena, std::move(expression))}; }
+
+  /// @returns @p expression with every operator parenthesized, so that its shape is visible
+  std::string render(Expression const& expression) const
+  {
+    if (auto const* op = std::get_if<Operator>(&expression.expression()))
+    {
+      return "(" + render(op->a()) + " + " + render(op->b()) + ")";
+    }
+
+    auto const& value = std::get<Value>(expression.expression()).value();
+    if (auto const* local = std::get_if<LocalVariable>(&value))
+    {
+      return std::string(names.name(local->name()));
+    }
+
+    std::ostringstream out;
+    std::visit([&out](auto constant) { out << constant; }, std::get<Constant>(value).constant());
+    return out.str();
+  }
+
+  Arena arena;
+  util::Interner names;
+};
+}  // namespace jackal::ast::tests
@@ -0,0 +1,108 @@
+#include "tests/catch.hpp"
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "ast/flat_tree.hpp"
+#include "util/interner.hpp"
+
+using jackal::ast::FlatTree;
+using jackal::ast::Operator;
+using jackal::util::Interner;
+using jackal::util::Symbol;
+
+namespace
+{
+/// Records the events of a FlatTree walk as a compact textual trace.
+struct TraceVisitor : public jackal::ast::FlatVisitor
+{
+  explicit TraceVisitor(Interner const& names) noexcept : names(names) {}
+
+  void enter_binding(Symbol variable) noexcept override
+  {
+    trace += "let " + std::string(names.name(variable)) + " = ";
+  }
+  void leave_binding() noexcept override { trace += ";"; }
+
+  void enter_print() noexcept override { trace += "print "; }
+  void leave_print() noexcept override { trace += ";"; }
+
+  void visit_operator(Operator::Type /*unused*/) noexcept override { trace += " + "; }
+
+  void visit_integer(int64_t value) noexcept override { trace += std::to_string(value); }
+  void visit_double(double value) noexcept override { trace += std::to_string(value); }
+  void visit_local(Symbol name) noexcept override { trace += names.name(name); }
+
+  Interner const& names;
+  std::string trace;
+};
+}  // namespace
+
+TEST_CASE("FlatTree should store children before their parents", "[ast][flat]")
+{
+  Interner names;
+  FlatTree tree;
+  auto a = tree.add_local(names.intern("a"));
+  auto one = tree.add_integer(1);
+  auto sum = tree.add_operator(Operator::Type::Add, a, one);
+  auto binding = tree.add_binding(names.intern("b"), sum);
+
+  REQUIRE(tree.size() == 4);
+  REQUIRE(a < sum);
+  REQUIRE(one < sum);
+  REQUIRE(sum < binding);
+  REQUIRE(tree.kind(sum) == FlatTree::Kind::Add);
+  REQUIRE(tree.a(sum) == a);
+  REQUIRE(tree.b(sum) == one);
+  REQUIRE(names.name(tree.name(a)) == "a");
+  REQUIRE(tree.integer(one) == 1);
+  REQUIRE(names.name(tree.name(binding)) == "b");
+  REQUIRE(tree.expression(binding) == sum);
+}
+
+TEST_CASE("FlatTree should record instructions in source order", "[ast][flat]")
+{
+  Interner names;
+  FlatTree tree;
+  auto first = tree.add_binding(names.intern("x"), tree.add_double(1.5));
+  auto second = tree.add_print(tree.add_local(names.intern("x")));
+
+  REQUIRE(tree.instructions() == std::vector<FlatTree::NodeId>{first, second});
+  REQUIRE(tree.kind(second) == FlatTree::Kind::Print);
+  REQUIRE(tree.floating(tree.expression(first)) == 1.5);
+  REQUIRE(tree.name(first) == tree.name(tree.expression(second)));
+}
+
+TEST_CASE("FlatTree walks should visit operators between their operands", "[ast][flat]")
+{
+  Interner names;
+  FlatTree tree;
+  auto x = names.intern("x");
+  tree.add_binding(x, tree.add_integer(1));
+  // print 1 + (x + 2), nested to the right unlike the trees the parser builds
+  auto nested = tree.add_operator(Operator::Type::Add, tree.add_local(x), tree.add_integer(2));
+  tree.add_print(tree.add_operator(Operator::Type::Add, tree.add_integer(1), nested));
+
+  TraceVisitor visitor(names);
+  tree.accept(visitor);
+  REQUIRE(visitor.trace == "let x = 1;print 1 + x + 2;");
+}
+
+TEST_CASE("FlatTree walks should handle deeply nested expressions", "[ast][flat]")
+{
+  constexpr auto Depth = 100000;
+
+  Interner names;
+  FlatTree tree;
+  auto expr = tree.add_integer(0);
+  for (auto i = 0; i < Depth; ++i)
+  {
+    expr = tree.add_operator(Operator::Type::Add, tree.add_integer(1), expr);
+  }
+  tree.add_print(expr);
+
+  TraceVisitor visitor(names);
+  tree.accept(visitor);
+  REQUIRE(visitor.trace.size() == std::string("print ").size() + Depth * 4 + 2);
+}
@@ -0,0 +1,120 @@
+#include "tests/catch.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "ast/liveness.hpp"
+#include "ast/partial_evaluation.hpp"
+#include "ast/program.hpp"
+#include "ast/tests/expressions.hpp"
+
+using jackal::ast::eliminate_dead_bindings;
+using jackal::ast::Liveness;
+using jackal::ast::Program;
+using jackal::ast::tests::Expressions;
+
+namespace
+{
+auto last_uses(Liveness const& liveness, std::size_t count) -> std::vector<std::size_t>
+{
+  std::vector<std::size_t> uses;
+  for (std::size_t i = 0; i < count; ++i)
+  {
+    uses.push_back(liveness.last_use(i));
+  }
+  return uses;
+}
+
+auto slots(Liveness const& liveness, std::size_t count) -> std::vector<std::size_t>
+{
+  std::vector<std::size_t> assigned;
+  for (std::size_t i = 0; i < count; ++i)
+  {
+    assigned.push_back(liveness.slot(i));
+  }
+  return assigned;
+}
+}  // namespace
+
+TEST_CASE("Liveness should find the last read of each bound value", "[ast][liveness]")
+{
+  constexpr auto Dead = Liveness::Dead;
+
+  // tests/resources/print_expression.jkl
+  Expressions e;
+  Program program(e.arena);
+  program.add_instruction(e.let("x", e.constant(int64_t{1})));
+  program.add_instruction(e.let("y", e.constant(int64_t{2})));
+  program.add_instruction(e.let("z", e.add(e.local("x"), e.local("y"))));
+  program.add_instruction(e.let("a", e.add(e.constant(int64_t{3}), e.constant(int64_t{4}))));
+  program.add_instruction(e.print(e.add(e.local("a"), e.local("z"))));
+  program.add_instruction(e.let("b", e.add(e.local("z"), e.local("a"))));
+  program.add_instruction(e.print(e.local("b")));
+
+  Liveness liveness(program);
+  REQUIRE(last_uses(liveness, 7) == std::vector<std::size_t>{2, 2, 5, 5, Dead, 6, Dead});
+  // z takes the slot of x, and b the slot of z, as each is bound where the other is last read
+  REQUIRE(slots(liveness, 7) == std::vector<std::size_t>{0, 1, 0, 1, Dead, 0, Dead});
+  REQUIRE(liveness.local_count() == 2);
+}
+
+TEST_CASE("Liveness should treat bindings that only feed dead bindings as dead",
+          "[ast][liveness]")
+{
+  Expressions e;
+  Program program(e.arena);
+  program.add_instruction(e.let("x", e.constant(int64_t{1})));
+  program.add_instruction(e.let("y", e.add(e.local("x"), e.constant(int64_t{1}))));
+  program.add_instruction(e.let("z", e.constant(int64_t{2})));
+  program.add_instruction(e.print(e.local("z")));
+
+  Liveness liveness(program);
+  REQUIRE_FALSE(liveness.live(0));
+  REQUIRE_FALSE(liveness.live(1));
+  REQUIRE(liveness.live(2));
+  REQUIRE_FALSE(liveness.live(3));
+  REQUIRE(liveness.slot(2) == 0);
+  REQUIRE(liveness.local_count() == 1);
+}
+
+TEST_CASE("Liveness should let a binding read the value it replaces", "[ast][liveness]")
+{
+  Expressions e;
+  Program program(e.arena);
+  program.add_instruction(e.let("x", e.constant(int64_t{1})));
+  program.add_instruction(e.let("x", e.add(e.local("x"), e.constant(int64_t{1}))));
+  program.add_instruction(e.print(e.local("x")));
+  program.add_instruction(e.let("x", e.constant(int64_t{7})));
+  program.add_instruction(e.print(e.local("x")));
+
+  Liveness liveness(program);
+  REQUIRE(liveness.last_use(0) == 1);
+  REQUIRE(liveness.last_use(1) == 2);
+  REQUIRE(liveness.last_use(3) == 4);
+  REQUIRE(liveness.slot(1) == liveness.slot(0));
+  REQUIRE(liveness.local_count() == 1);
+}
+
+TEST_CASE("Dead binding elimination should keep the output of the program", "[ast][liveness]")
+{
+  Expressions e;
+  Program program(e.arena);
+  program.add_instruction(e.let("unused", e.constant(int64_t{5})));
+  program.add_instruction(e.let("x", e.constant(int64_t{1})));
+  program.add_instruction(e.let("y", e.add(e.local("x"), e.local("unused"))));
+  program.add_instruction(e.print(e.local("x")));
+  program.add_instruction(e.let("z", e.local("x")));
+  program.add_instruction(e.print(e.add(e.local("x"), e.constant(int64_t{1}))));
+
+  auto output = jackal::ast::partially_evaluate(program).output;
+  REQUIRE(eliminate_dead_bindings(program) == 3);
+  REQUIRE(program.instructions().size() == 3);
+  REQUIRE(e.names.name(program.instructions()[0].binding_unsafe().variable().name()) == "x");
+  REQUIRE(jackal::ast::partially_evaluate(program).output == output);
+
+  REQUIRE(eliminate_dead_bindings(program) == 0);
+  Liveness liveness(program);
+  REQUIRE(liveness.live(0));
+  REQUIRE(liveness.local_count() == 1);
+}
@@ -0,0 +1,118 @@
+#include "tests/catch.hpp"
+
+#include <cstdint>
+#include <limits>
+#include <optional>
+#include <string>
+#include <vector>
+
+#include "ast/partial_evaluation.hpp"
+#include "ast/program.hpp"
+#include "ast/tests/expressions.hpp"
+
+using jackal::ast::partially_evaluate;
+using jackal::ast::Program;
+using jackal::ast::tests::Expressions;
+
+using Values = std::vector<std::optional<int64_t>>;
+
+TEST_CASE("Partial evaluation should propagate bindings into later references", "[ast][eval]")
+{
+  Expressions e;
+  Program program(e.arena);
+  // let x = 1; let y = 2; let z = x + y; let a = 3 + 4; print a + z; let b = z + a; print b
+  program.add_instruction(e.let("x", e.constant(int64_t{1})));
+  program.add_instruction(e.let("y", e.constant(int64_t{2})));
+  program.add_instruction(e.let("z", e.add(e.local("x"), e.local("y"))));
+  program.add_instruction(e.let("a", e.add(e.constant(int64_t{3}), e.constant(int64_t{4}))));
+  program.add_instruction(e.print(e.add(e.local("a"), e.local("z"))));
+  program.add_instruction(e.let("b", e.add(e.local("z"), e.local("a"))));
+  program.add_instruction(e.print(e.local("b")));
+
+  auto evaluation = partially_evaluate(program);
+  REQUIRE(evaluation.values == Values{1, 2, 3, 7, 10, 10, 10});
+  REQUIRE(evaluation.output == "10\n10\n");
+}
+
+TEST_CASE("Partial evaluation should know the output of programs that print nothing",
+          "[ast][eval]")
+{
+  Expressions e;
+  Program program(e.arena);
+  REQUIRE(partially_evaluate(program).output == "");
+
+  program.add_instruction(e.let("x", e.constant(int64_t{1})));
+  REQUIRE(partially_evaluate(program).output == "");
+}
+
+TEST_CASE("Partial evaluation should truncate doubles stored in variables", "[ast][eval]")
+{
+  Expressions e;
+  Program program(e.arena);
+  program.add_instruction(e.let("x", e.add(e.constant(int64_t{1}), e.constant(1.75))));
+  program.add_instruction(e.let("y", e.constant(-2.5)));
+  program.add_instruction(e.print(e.add(e.local("x"), e.local("y"))));
+
+  auto evaluation = partially_evaluate(program);
+  REQUIRE(evaluation.values == Values{2, -2, 0});
+  REQUIRE(evaluation.output == "0\n");
+}
+
+TEST_CASE("Partial evaluation should truncate the exact value of a double", "[ast][eval]")
+{
+  Expressions e;
+  Program program(e.arena);
+  // let x = 0.9999999; print x: the C backend emits the literal exactly, so this prints 0
+  program.add_instruction(e.let("x", e.constant(0.9999999)));
+  program.add_instruction(e.print(e.local("x")));
+
+  auto evaluation = partially_evaluate(program);
+  REQUIRE(evaluation.values == Values{0, 0});
+  REQUIRE(evaluation.output == "0\n");
+}
+
+TEST_CASE("Partial evaluation should leave to run time what it cannot compute as C would",
+          "[ast][eval]")
+{
+  Expressions e;
+  Program program(e.arena);
+
+  SECTION("printing a double")
+  {
+    program.add_instruction(e.print(e.add(e.constant(int64_t{1}), e.constant(0.5))));
+  }
+
+  SECTION("a reference to an unbound variable")
+  {
+    program.add_instruction(e.print(e.local("x")));
+  }
+
+  SECTION("a value that does not fit in an int")
+  {
+    program.add_instruction(
+        e.let("x", e.constant(int64_t{std::numeric_limits<int>::max()} + 1)));
+    program.add_instruction(e.print(e.constant(int64_t{1})));
+    program.add_instruction(e.print(e.local("x")));
+  }
+
+  auto evaluation = partially_evaluate(program);
+  REQUIRE_FALSE(evaluation.values.back().has_value());
+  REQUIRE_FALSE(evaluation.output.has_value());
+}
+
+TEST_CASE("Partial evaluation should handle deeply nested expressions", "[ast][eval]")
+{
+  constexpr auto Depth = 100000;
+
+  Expressions e;
+  Program program(e.arena);
+  program.add_instruction(e.let("x", e.constant(int64_t{1})));
+  auto expression = e.local("x");
+  for (auto i = 0; i < Depth; ++i)
+  {
+    expression = e.add(e.local("x"), std::move(expression));
+  }
+  program.add_instruction(e.print(std::move(expression)));
+
+  REQUIRE(partially_evaluate(program).output == std::to_string(Depth + 1) + "\n");
+}
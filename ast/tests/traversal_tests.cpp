@@ -0,0 +1,152 @@
+#include "tests/catch.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <variant>
+
+#include "ast/expression.hpp"
+#include "ast/operator.hpp"
+#include "ast/tests/expressions.hpp"
+#include "ast/traversal.hpp"
+#include "ast/value.hpp"
+#include "ast/visitor.hpp"
+
+using jackal::ast::Expression;
+using jackal::ast::walk;
+using jackal::ast::WalkOrder;
+using jackal::ast::tests::Expressions;
+
+namespace
+{
+/// Records the nodes reported by a walk as a space separated trace.
+struct TraceVisitor : public jackal::ast::Visitor
+{
+  explicit TraceVisitor(Expressions const& e) noexcept : e(e) {}
+
+  void visit(jackal::ast::Argument& /*node*/) noexcept override {}
+  void visit(jackal::ast::Arguments& /*node*/) noexcept override {}
+  void visit(jackal::ast::Context& /*node*/) noexcept override {}
+  void visit(jackal::ast::Data& /*node*/) noexcept override {}
+  void visit(jackal::ast::Executable& /*node*/) noexcept override {}
+  void visit(jackal::ast::Expressions& /*node*/) noexcept override {}
+  void visit(jackal::ast::Form& /*node*/) noexcept override {}
+  void visit(jackal::ast::Function& /*node*/) noexcept override {}
+  void visit(jackal::ast::FunctionCall& /*node*/) noexcept override {}
+  void visit(jackal::ast::Member& /*node*/) noexcept override {}
+  void visit(jackal::ast::Number& /*node*/) noexcept override {}
+  void visit(jackal::ast::Parameters& /*node*/) noexcept override {}
+  void visit(jackal::ast::Primitive& /*node*/) noexcept override {}
+  void visit(jackal::ast::PropertyAccess& /*node*/) noexcept override {}
+  void visit(jackal::ast::Scope& /*node*/) noexcept override {}
+  void visit(jackal::ast::Type& /*node*/) noexcept override {}
+  void visit(jackal::ast::Variable& /*node*/) noexcept override {}
+  void visit(jackal::ast::ValueV1& /*node*/) noexcept override {}
+
+  void visit(jackal::ast::Operator& /*node*/) noexcept override
+  {
+    ++operators;
+    append("+");
+  }
+
+  void visit(jackal::ast::Expression& node) noexcept override
+  {
+    walk(node, *this, WalkOrder::InOrder);
+  }
+  void visit(jackal::ast::Binding& /*node*/) noexcept override {}
+  void visit(jackal::ast::Print& /*node*/) noexcept override {}
+
+  void visit(jackal::ast::Instruction& /*node*/) noexcept override {}
+  void visit(jackal::ast::Program& /*node*/) noexcept override {}
+
+  void visit(jackal::ast::Value& node) noexcept override
+  {
+    ++values;
+    std::visit([this](auto& variant) { variant.accept(*this); }, node.value());
+  }
+  void visit(jackal::ast::Constant& node) noexcept override
+  {
+    std::visit([this](auto constant) { append(std::to_string(constant)); }, node.constant());
+  }
+  void visit(jackal::ast::LocalVariable& node) noexcept override
+  {
+    append(std::string(e.names.name(node.name())));
+  }
+
+  void append(std::string const& node)
+  {
+    if (record)
+    {
+      trace += trace.empty() ? node : " " + node;
+    }
+  }
+
+  Expressions const& e;
+  std::string trace;
+  bool record = true;
+  std::size_t operators = 0;
+  std::size_t values = 0;
+};
+}  // namespace
+
+TEST_CASE("Walks should report operators between or after their operands", "[ast][walk]")
+{
+  Expressions e;
+  // (1 + x) + (y + 2)
+  auto expression = e.add(e.add(e.constant(int64_t{1}), e.local("x")),
+                          e.add(e.local("y"), e.constant(int64_t{2})));
+  TraceVisitor visitor(e);
+
+  SECTION("in order")
+  {
+    walk(expression, visitor, WalkOrder::InOrder);
+    REQUIRE(visitor.trace == "1 + x + y + 2");
+  }
+
+  SECTION("in post order")
+  {
+    walk(expression, visitor, WalkOrder::PostOrder);
+    REQUIRE(visitor.trace == "1 x + y 2 + +");
+  }
+}
+
+TEST_CASE("Walks should report a lone value", "[ast][walk]")
+{
+  Expressions e;
+  auto expression = e.local("x");
+  TraceVisitor visitor(e);
+  expression.accept(visitor);
+  REQUIRE(visitor.trace == "x");
+}
+
+TEST_CASE("Walks should handle deeply nested expressions", "[ast][walk]")
+{
+  constexpr auto Depth = 1000000;
+
+  Expressions e;
+  TraceVisitor visitor(e);
+  visitor.record = false;
+
+  SECTION("nested to the left")
+  {
+    auto expression = e.local("x");
+    for (auto i = 0; i < Depth; ++i)
+    {
+      expression = e.add(std::move(expression), e.constant(int64_t{1}));
+    }
+    walk(expression, visitor, WalkOrder::PostOrder);
+  }
+
+  SECTION("nested to the right")
+  {
+    auto expression = e.local("x");
+    for (auto i = 0; i < Depth; ++i)
+    {
+      expression = e.add(e.constant(int64_t{1}), std::move(expression));
+    }
+    expression.accept(visitor);
+  }
+
+  REQUIRE(visitor.operators == Depth);
+  REQUIRE(visitor.values == Depth + 1);
+}
@@ -0,0 +1,27 @@
+#pragma once
+
+#include "ast/expression.hpp"
+#include "ast/visitor.hpp"
+
+namespace jackal::ast
+{
+/// @brief The point at which walk reports an Operator relative to its operands.
+enum class WalkOrder
+{
+  /// Between its operands, the order in which it appears in the source
+  InOrder,
+  /// After both of its operands, the order in which it is evaluated
+  PostOrder
+};
+
+/// @brief Walks the tree of @p expression, reporting every Operator and Value to @p visitor.
+///
+/// Operands are walked left before right, on an explicit worklist rather than the native stack, so
+/// the depth of the tree is limited only by memory. Visitors driven by walk handle each node on its
+/// own: their visit(Operator&) must not descend into the operands, which walk reports separately,
+/// and visit(Expression&) is never called for the nested expressions.
+///
+/// Nodes are owned by an Arena and their destructors release nothing, so tearing down a deep tree
+/// does not recurse either.
+void walk(Expression& expression, Visitor& visitor, WalkOrder order) noexcept;
+}  // namespace jackal::ast
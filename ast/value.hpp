@@ -4,12 +4,13 @@
 #include <cstdint>
 #include <memory>
 #include <optional>
-#include <string_view>
 #include <variant>
 
+#include "ast/arena.hpp"
 #include "ast/builder.hpp"
 #include "ast/node.hpp"
 #include "ast/visitor.hpp"
+#include "util/interner.hpp"
 
 // clang-format off
 namespace jackal::ast { struct Primitive; }
@@ -49,8 +50,8 @@ struct ValueV1 : public AbstractSyntaxNode
 
 struct Constant : public AbstractSyntaxNode
 {
-  explicit Constant(int64_t constant) noexcept;
-  explicit Constant(double constant) noexcept;
+  Constant(Arena& arena, int64_t constant) noexcept;
+  Constant(Arena& arena, double constant) noexcept;
 
   ~Constant() override;
   Constant(Constant const&) = delete;
@@ -70,12 +71,12 @@ struct Constant : public AbstractSyntaxNode
 
  private:
   struct Impl;
-  std::unique_ptr<Impl> _impl;
+  ArenaPtr<Impl> _impl;
 };
 
 struct LocalVariable : public AbstractSyntaxNode
 {
-  explicit LocalVariable(std::string_view name) noexcept;
+  LocalVariable(Arena& arena, util::Symbol name) noexcept;
 
   ~LocalVariable() override;
   LocalVariable(LocalVariable const&) = delete;
@@ -85,35 +86,37 @@ struct LocalVariable : public AbstractSyntaxNode
 
   void accept(Visitor& visitor) noexcept override { visitor.visit(*this); }
 
-  [[nodiscard]] std::string_view name() const noexcept;
+  [[nodiscard]] util::Symbol name() const noexcept;
 
  private:
   struct Impl;
-  std::unique_ptr<Impl> _impl;
+  ArenaPtr<Impl> _impl;
 };
 
 struct Value : public AbstractSyntaxNode
 {
   struct Builder : public AstBuilder
   {
+    explicit Builder(Arena& arena) noexcept : _arena(arena) {}
+
     Builder& set_constant(int64_t constant) noexcept
     {
       modified();
-      _constant = Constant(constant);
+      _constant = Constant(_arena, constant);
       return *this;
     }
 
     Builder& set_constant(double constant) noexcept
     {
       modified();
-      _constant = Constant(constant);
+      _constant = Constant(_arena, constant);
       return *this;
     }
 
-    Builder& set_local(std::string_view local) noexcept
+    Builder& set_local(util::Symbol local) noexcept
     {
       modified();
-      _local = LocalVariable(local);
+      _local = LocalVariable(_arena, local);
       return *this;
     }
 
@@ -122,19 +125,20 @@ struct Value : public AbstractSyntaxNode
       assert(_constant.has_value() ^ _local.has_value());
       if (_constant.has_value())
       {
-        return Value(std::move(*_constant));
+        return {_arena, std::move(*_constant)};
       }
 
-      return Value(std::move(*_local));
+      return {_arena, std::move(*_local)};
     }
 
    private:
+    Arena& _arena;
     std::optional<Constant> _constant;
     std::optional<LocalVariable> _local;
   };
 
-  explicit Value(Constant constant) noexcept;
-  explicit Value(LocalVariable local) noexcept;
+  Value(Arena& arena, Constant constant) noexcept;
+  Value(Arena& arena, LocalVariable local) noexcept;
 
   ~Value() override;
   Value(Value const&) = delete;
@@ -154,6 +158,6 @@ struct Value : public AbstractSyntaxNode
 
  private:
   struct Impl;
-  std::unique_ptr<Impl> _impl;
+  ArenaPtr<Impl> _impl;
 };
 }  // namespace jackal::ast
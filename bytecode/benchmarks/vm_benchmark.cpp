@@ -0,0 +1,279 @@
+/// @file Compares the bytecode VM against the C backend on the test resource programs.
+///
+/// Usage: jackal_vm_benchmark RESOURCE_DIR [C_COMPILER]
+///
+/// Every RESOURCE_DIR/NAME.jkl with a matching NAME.c (the C backend's expected output) is
+/// measured twice:
+///
+///   edit-run: the time from source to printed output, i.e. compiling the C with C_COMPILER (cc
+///             by default) and running it, against lowering to bytecode and running the VM;
+///   steady:   the time to run the program body repeated Repetitions times, excluding C
+///             compilation, which isolates the cost of instruction dispatch, both as generated
+///             and after fusing superinstructions, and compiled to native code by the JIT
+///             where it supports the host;
+///   startup:  the time to lower the repeated program from source, against mapping and verifying
+///             it from a .jkb bytecode file.
+///
+/// The Jackal sources are read by a minimal reader for the straight-line let/print subset, since
+/// the parser does not yet accept the token stream produced by the current lexer, and lowered by
+/// the bytecode generator.
+#include <cctype>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <filesystem>
+#include <fstream>
+#include <functional>
+#include <iostream>
+#include <optional>
+#include <sstream>
+#include <string>
+#include <string_view>
+
+#include "ast/arena.hpp"
+#include "ast/include.hpp"
+#include "bytecode/bytecode_file.hpp"
+#include "bytecode/fusion.hpp"
+#include "bytecode/jit.hpp"
+#include "bytecode/instruction_stream.hpp"
+#include "bytecode/vm.hpp"
+#include "codegen/bytecode/bytecode_visitor.hpp"
+#include "util/exec.hpp"
+#include "util/file_system.hpp"
+#include "util/interner.hpp"
+
+using jackal::ast::Arena;
+using jackal::ast::Expression;
+using jackal::ast::Instruction;
+using jackal::ast::Operator;
+using jackal::ast::Program;
+using jackal::ast::Value;
+using jackal::bytecode::instruction_stream;
+using jackal::bytecode::mapped_file;
+using jackal::bytecode::vm;
+using jackal::codegen::bytecode::BytecodeVisitor;
+using jackal::util::Interner;
+
+namespace
+{
+constexpr auto Repetitions = 20000;
+
+using seconds = std::chrono::duration<double>;
+
+auto read_file(std::filesystem::path const& path) -> std::string
+{
+  std::ifstream inputStream(path);
+  std::stringstream iss;
+  iss << inputStream.rdbuf();
+  return iss.str();
+}
+
+/// Reads `let NAME = TERM [+ TERM]...` and `print TERM [+ TERM]...` lines into a Program, where
+/// each TERM is an integer or a name, and lowers it with the bytecode generator. Sums nest to the
+/// right as they do in the parser.
+auto lower(std::string const& source) -> instruction_stream
+{
+  Arena arena;
+  Interner interner;
+  Program program(arena);
+
+  auto read_term = [&](std::string const& term) -> Expression
+  {
+    Value::Builder builder(arena);
+    if (std::isdigit(static_cast<unsigned char>(term.front())) != 0 || term.front() == '-')
+    {
+      builder.set_constant(static_cast<int64_t>(std::stoll(term)));
+    }
+    else
+    {
+      builder.set_local(interner.intern(term));
+    }
+    return {arena, builder.build()};
+  };
+
+  std::function<Expression(std::istringstream&)> read_expression =
+      [&](std::istringstream& line) -> Expression
+  {
+    std::string term;
+    std::string plus;
+    line >> term;
+    auto a = read_term(term);
+    if (!(line >> plus))
+    {
+      return a;
+    }
+
+    Operator::Builder builder(arena);
+    builder.set_type(Operator::Type::Add);
+    builder.set_a(std::move(a));
+    builder.set_b(read_expression(line));
+    return {arena, builder.build()};
+  };
+
+  std::istringstream lines(source);
+  for (std::string text; std::getline(lines, text);)
+  {
+    std::istringstream line(text);
+    std::string keyword;
+    line >> keyword;
+
+    Instruction::Builder builder(arena);
+    if (keyword == "let")
+    {
+      std::string name;
+      std::string equals;
+      line >> name >> equals;
+      builder.binding.set_variable(interner.intern(name));
+      builder.binding.set_expression(read_expression(line));
+    }
+    else if (keyword == "print")
+    {
+      builder.print.set_expression(read_expression(line));
+    }
+    else
+    {
+      continue;
+    }
+    program.add_instruction(builder.build());
+  }
+
+  BytecodeVisitor generator;
+  program.accept(generator);
+  return generator.code();
+}
+
+/// Wraps each repetition of the body of main in its own block so that declarations do not clash.
+auto repeat_c(std::string const& source) -> std::string
+{
+  auto bodyStart = source.find('{') + 1;
+  auto bodyEnd = source.rfind('}');
+  auto body = source.substr(bodyStart, bodyEnd - bodyStart);
+
+  std::string repeated = source.substr(0, bodyStart);
+  for (auto i = 0; i < Repetitions; ++i)
+  {
+    repeated += "{" + body + "}\n";
+  }
+  return repeated + "}\n";
+}
+
+auto repeat_jackal(std::string const& source) -> std::string
+{
+  std::string repeated;
+  for (auto i = 0; i < Repetitions; ++i)
+  {
+    repeated += source + "\n";
+  }
+  return repeated;
+}
+
+template <typename Function>
+auto time(Function function) -> seconds
+{
+  auto start = std::chrono::steady_clock::now();
+  function();
+  return std::chrono::steady_clock::now() - start;
+}
+
+auto run_vm(std::string const& source, std::FILE* output) -> void
+{
+  vm machine;
+  machine.run(jackal::bytecode::fuse(lower(source)), output);
+}
+
+auto compile_c(std::string const& compiler, std::filesystem::path const& source,
+               std::filesystem::path const& executable) -> bool
+{
+  return jackal::util::exec(compiler + " " + source.string() + " -o " + executable.string())
+      .has_value();
+}
+
+auto measure(std::filesystem::path const& jackalPath, std::string const& compiler) -> void
+{
+  auto cPath = std::filesystem::path(jackalPath).replace_extension(".c");
+  auto jackalSource = read_file(jackalPath);
+  jackal::util::TemporaryDirectory dir;
+  auto executable = dir.directory() / "program.out";
+  auto* devNull = std::fopen("/dev/null", "w");
+
+  // Edit-run: source to output
+  auto cEditRun = time(
+      [&]
+      {
+        if (compile_c(compiler, cPath, executable))
+        {
+          static_cast<void>(jackal::util::exec(executable.string()));
+        }
+      });
+  auto vmEditRun = time([&] { run_vm(jackalSource, devNull); });
+
+  // Steady: the same body repeated, C compiled ahead of time
+  auto repeatedC = dir.directory() / "repeated.c";
+  std::ofstream(repeatedC) << repeat_c(read_file(cPath));
+  auto repeatedJackal = repeat_jackal(jackalSource);
+  if (!compile_c(compiler, repeatedC, executable))
+  {
+    std::cerr << "failed to compile " << repeatedC << std::endl;
+    return;
+  }
+  auto cSteady = time(
+      [&]
+      {
+        static_cast<void>(jackal::util::exec(executable.string() + " > /dev/null"));
+      });
+
+  instruction_stream code;
+  auto lowerStartup = time([&] { code = lower(repeatedJackal); });
+  vm machine;
+  auto vmSteady = time([&] { machine.run(code, devNull); });
+  auto fused = jackal::bytecode::fuse(code);
+  auto fusedSteady = time([&] { machine.run(fused, devNull); });
+  std::optional<jackal::bytecode::native_code> native;
+  auto jitCompile = time([&] { native = jackal::bytecode::native_code::compile(fused.view()); });
+  auto jitSteady = native ? time([&] { machine.run(*native, devNull); }) : seconds(0);
+  std::fclose(devNull);
+
+  auto bytecodePath = dir.directory() / "repeated.jkb";
+  static_cast<void>(jackal::bytecode::write_file(fused, bytecodePath));
+  auto fileStartup = time([&] { static_cast<void>(mapped_file::load(bytecodePath)); });
+
+  std::cout << jackalPath.filename().string() << std::endl;
+  std::cout << "  edit-run: c " << cEditRun.count() * 1000 << " ms, vm "
+            << vmEditRun.count() * 1000 << " ms" << std::endl;
+  auto instructionsPerSecond = static_cast<double>(code.instruction_count()) / vmSteady.count();
+  std::cout << "  steady:   c " << cSteady.count() * 1000 << " ms, vm " << vmSteady.count() * 1000
+            << " ms (" << static_cast<uint64_t>(instructionsPerSecond) << " instructions/sec, "
+            << code.size() << " bytes of bytecode)" << std::endl;
+  std::cout << "  fused:    vm " << fusedSteady.count() * 1000 << " ms ("
+            << fused.instruction_count() << " instructions instead of " << code.instruction_count()
+            << ")" << std::endl;
+  if (native)
+  {
+    std::cout << "  jit:      native " << jitSteady.count() * 1000 << " ms (" << native->size()
+              << " bytes of machine code, compiled in " << jitCompile.count() * 1000 << " ms)"
+              << std::endl;
+  }
+  std::cout << "  startup:  source " << lowerStartup.count() * 1000 << " ms, .jkb "
+            << fileStartup.count() * 1000 << " ms" << std::endl;
+}
+}  // namespace
+
+auto main(int argc, char** argv) -> int
+{
+  if (argc < 2)
+  {
+    std::cerr << "Usage: jackal_vm_benchmark RESOURCE_DIR [C_COMPILER]" << std::endl;
+    return 1;
+  }
+
+  std::string compiler = argc > 2 ? argv[2] : "cc";  // NOLINT
+  for (auto const& entry : std::filesystem::directory_iterator(argv[1]))  // NOLINT
+  {
+    auto path = entry.path();
+    if (path.extension() == ".jkl" &&
+        std::filesystem::exists(std::filesystem::path(path).replace_extension(".c")))
+    {
+      measure(path, compiler);
+    }
+  }
+}
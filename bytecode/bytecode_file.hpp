@@ -0,0 +1,128 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <utility>
+
+#include "bytecode/code_view.hpp"
+#include "bytecode/instruction_stream.hpp"
+#include "util/result.hpp"
+
+namespace jackal::bytecode
+{
+/**
+ * The header at the start of a .jkb bytecode file.
+ *
+ * A file consists of the header, the constant pool as constant_count 64-bit integers, and then
+ * code_size bytes of encoded instructions, with nothing in between. The header is a multiple of
+ * eight bytes long, so a file mapped at a page boundary can be executed in place: the constants
+ * are suitably aligned and the instructions are exactly as the vm reads them.
+ *
+ * Everything is stored in the byte order of the machine that wrote the file. Files written with
+ * a different byte order are rejected rather than converted.
+ */
+struct file_header
+{
+  static constexpr uint32_t magic_number = 0x424b4a7f;  // "\x7fJKB" when little-endian
+  static constexpr uint16_t current_version = 1;
+  static constexpr uint16_t byte_order_mark = 0x0102;
+  /// The most registers and locals a program may declare together. The vm allocates a frame of
+  /// that many int64_t slots up front, so this bounds it at 128 MiB.
+  static constexpr std::size_t max_frame_slots = std::size_t{1} << 24;
+
+  uint32_t magic;
+  uint16_t version;
+  uint16_t byte_order;
+  uint32_t register_count;
+  uint32_t local_count;
+  uint32_t constant_count;
+  uint32_t reserved;
+  uint64_t code_size;
+};
+
+static_assert(sizeof(file_header) == 32);
+static_assert(sizeof(file_header) % alignof(int64_t) == 0);
+
+/**
+ * Describes why a bytecode file could not be loaded.
+ */
+struct load_error
+{
+  explicit load_error(std::string message) noexcept : _message(std::move(message)) {}
+
+  [[nodiscard]] std::string_view message() const noexcept { return _message; }
+
+ private:
+  std::string _message;
+};
+
+/**
+ * Checks that the vm can execute @p code without reading outside of it.
+ *
+ * Every instruction is visited once, in order: its opcode must be known, its operand encodings
+ * must be the ones its opcode takes, and its operands must refer to registers, locals and
+ * constants that the view declares. The code must end with a halt and contain nothing after it,
+ * and its registers and locals must fit in a frame of file_header::max_frame_slots.
+ *
+ * @returns std::nullopt if the code is valid
+ * @returns a description of the first problem found otherwise
+ */
+[[nodiscard]] std::optional<load_error> verify(code_view const& code) noexcept;
+
+/**
+ * Writes an instruction stream to a .jkb bytecode file.
+ *
+ * @returns std::nullopt if the file was written
+ * @returns a description of the failure otherwise
+ */
+[[nodiscard]] std::optional<load_error> write_file(instruction_stream const& code,
+                                                   std::filesystem::path const& path) noexcept;
+
+/**
+ * A .jkb bytecode file mapped read-only into memory.
+ *
+ * The vm executes the mapping directly; nothing is copied or relocated. Views of the file remain
+ * valid until the mapped_file is destroyed.
+ */
+struct mapped_file
+{
+  /// @brief Maps and verifies a bytecode file.
+  [[nodiscard]] static util::Result<mapped_file, load_error> load(
+      std::filesystem::path const& path) noexcept;
+
+  ~mapped_file() noexcept;
+
+  mapped_file(mapped_file const&) = delete;
+  mapped_file& operator=(mapped_file const&) = delete;
+
+  mapped_file(mapped_file&& other) noexcept
+      : _data(std::exchange(other._data, nullptr)), _size(std::exchange(other._size, 0))
+  {
+  }
+
+  mapped_file& operator=(mapped_file&& other) noexcept
+  {
+    std::swap(_data, other._data);
+    std::swap(_size, other._size);
+    return *this;
+  }
+
+  [[nodiscard]] file_header const& header() const noexcept
+  {
+    return *reinterpret_cast<file_header const*>(_data);  // NOLINT
+  }
+
+  /// @returns the code and constants of the file, ready to be run by the vm
+  [[nodiscard]] code_view view() const noexcept;
+
+ private:
+  uint8_t const* _data;
+  std::size_t _size;
+
+  mapped_file(uint8_t const* data, std::size_t size) noexcept : _data(data), _size(size) {}
+};
+}  // namespace jackal::bytecode
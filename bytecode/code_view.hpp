@@ -0,0 +1,23 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+namespace jackal::bytecode
+{
+/**
+ * A non-owning view of everything the vm needs to execute a program.
+ *
+ * The encoded instructions and constant pool may live in an instruction_stream or directly in a
+ * memory-mapped bytecode file; the vm does not distinguish between the two.
+ */
+struct code_view
+{
+  uint8_t const* code;
+  std::size_t size;
+  int64_t const* constants;
+  std::size_t constant_count;
+  std::size_t register_count;
+  std::size_t local_count;
+};
+}  // namespace jackal::bytecode
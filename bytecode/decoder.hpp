@@ -0,0 +1,43 @@
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <optional>
+
+#include "bytecode/encoding.hpp"
+#include "bytecode/instruction_stream.hpp"
+#include "bytecode/opcode.hpp"
+#include "bytecode/operand.hpp"
+
+namespace jackal::bytecode
+{
+/**
+ * A single instruction read back from an instruction_stream.
+ *
+ * Immediates and wide immediates are both decoded as constant operands, so a constant reads the
+ * same regardless of whether it was encoded inline or in the constant pool.
+ */
+struct decoded_instruction
+{
+  opcode op;
+  std::size_t operand_count;
+  std::array<operand, encoding::max_operands> operands;
+};
+
+/**
+ * Reads the instructions of an instruction_stream back in order, for tooling and tests.
+ *
+ * The vm does not use the decoder; it reads the operands of each opcode directly.
+ */
+struct decoder
+{
+  explicit decoder(instruction_stream const& stream) noexcept : _stream(stream) {}
+
+  /// @returns the next instruction, or std::nullopt once the terminating halt has been reached
+  std::optional<decoded_instruction> next() noexcept;
+
+ private:
+  instruction_stream const& _stream;
+  std::size_t _offset = 0;
+};
+}  // namespace jackal::bytecode
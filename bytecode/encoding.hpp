@@ -0,0 +1,120 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+
+#include "bytecode/opcode.hpp"
+
+namespace jackal::bytecode
+{
+/**
+ * How an encoded operand is interpreted.
+ *
+ * Registers, locals and immediates are stored inline; wide immediates that do not fit in 32 bits
+ * are stored in the constant pool of the stream and referenced by index.
+ */
+enum class operand_encoding : unsigned char
+{
+  reg = 0,
+  local = 1,
+  immediate = 2,
+  pool = 3
+};
+
+/**
+ * The packed binary layout of an encoded instruction:
+ *
+ *   byte 0       opcode
+ *   byte 1       operand encodings, two bits per operand with operand 0 in the lowest bits
+ *   bytes 2..    operands, four bytes each in host byte order
+ *
+ * The number of operands is fixed by the opcode, so instructions can be decoded without a length
+ * prefix and the vm can read the operands of a known opcode directly.
+ */
+namespace encoding
+{
+static constexpr std::size_t header_size = 2;
+static constexpr std::size_t operand_size = sizeof(uint32_t);
+static constexpr std::size_t max_operands = 3;
+static constexpr unsigned operand_encoding_bits = 2;
+
+/// One more than the largest opcode value
+static constexpr std::size_t opcode_count = static_cast<std::size_t>(opcode::store_const) + 1;
+
+constexpr std::size_t operand_count(opcode op) noexcept
+{
+  switch (op)
+  {
+    case opcode::add:
+    case opcode::add_local_local:
+    case opcode::add_const_local:
+      return 3;
+    case opcode::constant:
+    case opcode::wide_constant:
+    case opcode::store:
+    case opcode::load:
+    case opcode::store_const:
+      return 2;
+    case opcode::print:
+      return 1;
+    case opcode::halt:
+      return 0;
+  }
+  return 0;
+}
+
+/// @returns the operand encodings byte that every instruction with opcode @p op carries
+constexpr uint8_t operand_encodings(opcode op) noexcept
+{
+  auto pack = [](operand_encoding a, operand_encoding b = operand_encoding::reg,
+                 operand_encoding c = operand_encoding::reg)
+  {
+    return static_cast<uint8_t>(static_cast<unsigned>(a) |
+                                static_cast<unsigned>(b) << operand_encoding_bits |
+                                static_cast<unsigned>(c) << (2 * operand_encoding_bits));
+  };
+
+  switch (op)
+  {
+    case opcode::constant:
+      return pack(operand_encoding::reg, operand_encoding::immediate);
+    case opcode::wide_constant:
+      return pack(operand_encoding::reg, operand_encoding::pool);
+    case opcode::store:
+      return pack(operand_encoding::local, operand_encoding::reg);
+    case opcode::load:
+      return pack(operand_encoding::reg, operand_encoding::local);
+    case opcode::add_local_local:
+      return pack(operand_encoding::reg, operand_encoding::local, operand_encoding::local);
+    case opcode::add_const_local:
+      return pack(operand_encoding::reg, operand_encoding::immediate, operand_encoding::local);
+    case opcode::store_const:
+      return pack(operand_encoding::local, operand_encoding::immediate);
+    case opcode::add:
+    case opcode::print:
+    case opcode::halt:
+      return pack(operand_encoding::reg);
+  }
+  return 0;
+}
+
+constexpr std::size_t instruction_size(opcode op) noexcept
+{
+  return header_size + operand_count(op) * operand_size;
+}
+
+constexpr operand_encoding encoding_of(uint8_t encodings, std::size_t index) noexcept
+{
+  return static_cast<operand_encoding>((encodings >> (index * operand_encoding_bits)) & 0b11U);
+}
+
+/// @returns operand @p index of the instruction starting at @p instruction
+inline uint32_t read_operand(uint8_t const* instruction, std::size_t index) noexcept
+{
+  uint32_t value;  // NOLINT
+  std::memcpy(&value, instruction + header_size + index * operand_size, sizeof(value));
+  return value;
+}
+}  // namespace encoding
+}  // namespace jackal::bytecode
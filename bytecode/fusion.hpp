@@ -0,0 +1,22 @@
+#pragma once
+
+#include "bytecode/instruction_stream.hpp"
+
+namespace jackal::bytecode
+{
+/**
+ * Rewrites common instruction sequences as single superinstructions:
+ *
+ *   constant r, imm; store l, r                       ->  store_const l, imm
+ *   load ra, l0; load rb, l1; add rd, ra, rb          ->  add_local_local rd, l0, l1
+ *   constant ra, imm; load rb, l; add rd, ra, rb      ->  add_const_local rd, imm, l
+ *   load ra, l; constant rb, imm; add rd, ra, rb      ->  add_const_local rd, imm, l
+ *
+ * A sequence is only fused when the registers it skips writing are not read again before they are
+ * next written, which is always the case for code from the bytecode generator since each of its
+ * registers holds a single temporary. Only immediates are fused; wide constants are left as they
+ * are. Every other instruction is copied unchanged, so the result prints the same values and
+ * leaves the same locals as @p code, in fewer dispatches.
+ */
+[[nodiscard]] instruction_stream fuse(instruction_stream const& code) noexcept;
+}  // namespace jackal::bytecode
@@ -20,16 +20,16 @@ struct instruction_storage;
 template <std::size_t N>
 struct instruction_storage<N, true>
 {
-  opcode opcode;
+  opcode code;
   reg output;
-  operands<N> operands;
+  operands<N> args;
 };
 
 template <std::size_t N>
 struct instruction_storage<N, false>
 {
-  opcode opcode;
-  operands<N> operands;
+  opcode code;
+  operands<N> args;
 };
 
 /**
@@ -56,14 +56,14 @@ struct instruction
   {
   }
 
-  constexpr opcode get_opcode() const noexcept { return _storage.opcode; }
+  constexpr opcode get_opcode() const noexcept { return _storage.code; }
 
   template <std::size_t M>
   constexpr operand get_operand() const noexcept
   {
     if constexpr (M < N)
     {
-      return _storage.operands[M];
+      return _storage.args[M];
     }
   }
 
@@ -0,0 +1,77 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <initializer_list>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "bytecode/code_view.hpp"
+#include "bytecode/encoding.hpp"
+#include "bytecode/opcode.hpp"
+
+namespace jackal::bytecode
+{
+/**
+ * An encoded sequence of instructions ready to be executed by the vm.
+ *
+ * Instructions are packed as described in encoding.hpp. Constants that fit in 32 bits are encoded
+ * inline; wider constants are added to a deduplicated constant pool and loaded by wide_constant.
+ *
+ * The stream is always terminated by a halt instruction, so the vm never needs to compare its
+ * program counter against the end of the stream. It also tracks the highest register and local
+ * referenced so that the vm can size its storage once before executing.
+ */
+struct instruction_stream
+{
+  instruction_stream() noexcept { append(opcode::halt, {}); }
+
+  void emit_constant(uint64_t dest, int64_t value) noexcept;
+  void emit_add(uint64_t dest, uint64_t src0, uint64_t src1) noexcept;
+  void emit_store(uint64_t dest, uint64_t src) noexcept;
+  void emit_load(uint64_t dest, uint64_t src) noexcept;
+  void emit_print(uint64_t src) noexcept;
+
+  // Superinstructions, see fusion.hpp
+  void emit_add_local_local(uint64_t dest, uint64_t src0, uint64_t src1) noexcept;
+  void emit_add_const_local(uint64_t dest, int32_t value, uint64_t src) noexcept;
+  void emit_store_const(uint64_t dest, int32_t value) noexcept;
+
+  /// @returns the first byte of the first instruction
+  constexpr uint8_t const* code() const noexcept { return _code.data(); }
+
+  /// @returns the number of encoded bytes, including the terminating halt
+  constexpr std::size_t size() const noexcept { return _code.size(); }
+
+  /// @returns the number of instructions, including the terminating halt
+  constexpr std::size_t instruction_count() const noexcept { return _instructions; }
+
+  constexpr std::vector<int64_t> const& constants() const noexcept { return _constants; }
+
+  constexpr std::size_t register_count() const noexcept { return _registers; }
+
+  constexpr std::size_t local_count() const noexcept { return _locals; }
+
+  /// @returns a view of the stream, valid until the next instruction is emitted
+  constexpr code_view view() const noexcept
+  {
+    return {_code.data(), _code.size(), _constants.data(), _constants.size(), _registers, _locals};
+  }
+
+ private:
+  using encoded_operand = std::pair<operand_encoding, uint64_t>;
+
+  /// Encodes an instruction in place of the terminating halt, then re-terminates the stream
+  void emit(opcode op, std::initializer_list<encoded_operand> operands) noexcept;
+  void append(opcode op, std::initializer_list<encoded_operand> operands) noexcept;
+  uint32_t pool(int64_t value) noexcept;
+
+  std::vector<uint8_t> _code;
+  std::vector<int64_t> _constants;
+  std::unordered_map<int64_t, uint32_t> _pool;
+  std::size_t _instructions = 0;
+  std::size_t _registers = 0;
+  std::size_t _locals = 0;
+};
+}  // namespace jackal::bytecode
@@ -0,0 +1,73 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <optional>
+
+#include "bytecode/code_view.hpp"
+#include "bytecode/vm.hpp"
+
+#if defined(__x86_64__) && defined(__linux__) && !defined(JACKAL_DISABLE_JIT)
+#define JACKAL_JIT_X86_64 1
+#else
+#define JACKAL_JIT_X86_64 0
+#endif
+
+namespace jackal::bytecode
+{
+/**
+ * Native machine code compiled from bytecode by a baseline template JIT.
+ *
+ * Each instruction is translated on its own into a fixed x86-64 template that reads and writes
+ * the slots of the frame in memory, and the templates are stitched together in program order into
+ * an anonymous mapping. The mapping is written first and then made read-only and executable, so it
+ * is never writable and executable at once. Constants are embedded in the machine code, so the
+ * result does not depend on the view it was compiled from.
+ *
+ * The JIT is only available on x86-64 Linux; defining JACKAL_DISABLE_JIT turns it off everywhere.
+ * vm::run_native falls back to interpreting wherever compile() fails.
+ */
+struct native_code
+{
+  static constexpr bool supported = JACKAL_JIT_X86_64 == 1;
+
+  /**
+   * Compiles verified bytecode to native code.
+   *
+   * @returns std::nullopt if the JIT does not support the host, the frame is too large to address
+   *          with 32-bit displacements, or executable memory could not be mapped
+   */
+  [[nodiscard]] static std::optional<native_code> compile(code_view const& code) noexcept;
+
+  ~native_code() noexcept;
+
+  native_code(native_code const&) = delete;
+  native_code& operator=(native_code const&) = delete;
+
+  native_code(native_code&& other) noexcept;
+  native_code& operator=(native_code&& other) noexcept;
+
+  /// @returns the frame the code expects to be called with
+  [[nodiscard]] constexpr frame_layout const& layout() const noexcept { return _layout; }
+
+  /// @returns the number of bytes of machine code
+  [[nodiscard]] constexpr std::size_t size() const noexcept { return _size; }
+
+  /// @brief Executes the code in @p frame, which must be zeroed and sized as layout() describes
+  void operator()(int64_t* frame, std::FILE* output) const noexcept;
+
+ private:
+  using entry_point = void (*)(int64_t* frame, std::FILE* output);
+
+  void* _memory;
+  std::size_t _mapped;
+  std::size_t _size;
+  frame_layout _layout;
+
+  native_code(void* memory, std::size_t mapped, std::size_t size, frame_layout layout) noexcept
+      : _memory(memory), _mapped(mapped), _size(size), _layout(layout)
+  {
+  }
+};
+}  // namespace jackal::bytecode
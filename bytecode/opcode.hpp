@@ -1,13 +1,49 @@
 #pragma once
 
+#include <string_view>
+
 namespace jackal::bytecode
 {
 enum class opcode : unsigned char
 {
-  constant = 0,  // r_dest, val
-  add = 1,       // r_dest, r_src0, r_src1
-  store = 2,     // l_dest, r_src
-  load = 3,      // r_dest, l_src
-  print = 4      // r_src
+  constant = 0,         // r_dest, imm32
+  add = 1,              // r_dest, r_src0, r_src1
+  store = 2,            // l_dest, r_src
+  load = 3,             // r_dest, l_src
+  print = 4,            // r_src
+  halt = 5,             //
+  wide_constant = 6,    // r_dest, pool_index
+  add_local_local = 7,  // r_dest, l_src0, l_src1
+  add_const_local = 8,  // r_dest, imm32, l_src
+  store_const = 9       // l_dest, imm32
 };
+
+/// @returns the lowercase name of @p op, as written in comments and profiles
+constexpr std::string_view name(opcode op) noexcept
+{
+  switch (op)
+  {
+    case opcode::constant:
+      return "constant";
+    case opcode::add:
+      return "add";
+    case opcode::store:
+      return "store";
+    case opcode::load:
+      return "load";
+    case opcode::print:
+      return "print";
+    case opcode::halt:
+      return "halt";
+    case opcode::wide_constant:
+      return "wide_constant";
+    case opcode::add_local_local:
+      return "add_local_local";
+    case opcode::add_const_local:
+      return "add_const_local";
+    case opcode::store_const:
+      return "store_const";
+  }
+  return "unknown";
 }
+}  // namespace jackal::bytecode
@@ -0,0 +1,51 @@
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "bytecode/code_view.hpp"
+#include "bytecode/encoding.hpp"
+#include "bytecode/opcode.hpp"
+
+namespace jackal::bytecode
+{
+/**
+ * A run of consecutively dispatched opcodes and how many times it was dispatched.
+ */
+struct opcode_sequence
+{
+  std::array<opcode, 3> ops;
+  std::size_t length;
+  uint64_t count;
+};
+
+/**
+ * Counts how often each pair and triple of opcodes is dispatched back to back, to find the
+ * sequences most worth fusing into superinstructions.
+ *
+ * Programs are recorded in the order the vm dispatches their instructions, which for the current
+ * straight-line bytecode is the order they are encoded in. The terminating halt is not counted.
+ */
+struct dispatch_profile
+{
+  /// @brief Records @p runs executions of @p code, which must be verified
+  void record(code_view const& code, uint64_t runs = 1) noexcept;
+
+  /// @returns the total number of instructions dispatched across every recorded run
+  [[nodiscard]] uint64_t dispatches() const noexcept { return _dispatches; }
+
+  /// @returns the @p limit most frequent sequences of @p length 2 or 3, most frequent first and
+  /// then in opcode order
+  [[nodiscard]] std::vector<opcode_sequence> hottest(std::size_t length,
+                                                     std::size_t limit) const noexcept;
+
+ private:
+  static constexpr std::size_t N = encoding::opcode_count;
+
+  uint64_t _dispatches = 0;
+  std::array<uint64_t, N * N> _pairs{};
+  std::array<uint64_t, N * N * N> _triples{};
+};
+}  // namespace jackal::bytecode
@@ -0,0 +1,220 @@
+#include "bytecode/bytecode_file.hpp"
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <fstream>
+#include <limits>
+
+#include "bytecode/encoding.hpp"
+#include "bytecode/opcode.hpp"
+
+using jackal::bytecode::code_view;
+using jackal::bytecode::file_header;
+using jackal::bytecode::load_error;
+using jackal::bytecode::mapped_file;
+
+namespace encoding = jackal::bytecode::encoding;
+
+namespace
+{
+auto at(std::size_t offset, std::string_view problem) -> load_error
+{
+  return load_error("Invalid bytecode at offset " + std::to_string(offset) + ": " +
+                    std::string(problem));
+}
+}  // namespace
+
+auto jackal::bytecode::verify(code_view const& code) noexcept -> std::optional<load_error>
+{
+  // Checked separately so that the sum cannot overflow
+  if (code.register_count > file_header::max_frame_slots ||
+      code.local_count > file_header::max_frame_slots - code.register_count)
+  {
+    return load_error("Invalid bytecode: " + std::to_string(code.register_count) +
+                      " registers and " + std::to_string(code.local_count) +
+                      " locals exceed the frame limit of " +
+                      std::to_string(file_header::max_frame_slots) + " slots");
+  }
+
+  std::size_t offset = 0;
+  while (offset < code.size)
+  {
+    auto const* instruction = code.code + offset;
+    if (instruction[0] >= encoding::opcode_count)
+    {
+      return at(offset, "unknown opcode " + std::to_string(instruction[0]));
+    }
+
+    auto op = static_cast<opcode>(instruction[0]);
+    auto size = encoding::instruction_size(op);
+    if (code.size - offset < size)
+    {
+      return at(offset, "instruction is truncated");
+    }
+
+    auto encodings = encoding::operand_encodings(op);
+    if (instruction[1] != encodings)
+    {
+      return at(offset, "operand encodings do not match the opcode");
+    }
+
+    for (std::size_t i = 0; i < encoding::operand_count(op); ++i)
+    {
+      auto value = encoding::read_operand(instruction, i);
+      switch (encoding::encoding_of(encodings, i))
+      {
+        case operand_encoding::reg:
+          if (value >= code.register_count)
+          {
+            return at(offset, "register " + std::to_string(value) + " is out of range");
+          }
+          break;
+        case operand_encoding::local:
+          if (value >= code.local_count)
+          {
+            return at(offset, "local " + std::to_string(value) + " is out of range");
+          }
+          break;
+        case operand_encoding::pool:
+          if (value >= code.constant_count)
+          {
+            return at(offset, "constant " + std::to_string(value) + " is out of range");
+          }
+          break;
+        case operand_encoding::immediate:
+          break;
+      }
+    }
+
+    offset += size;
+    if (op == opcode::halt)
+    {
+      return offset == code.size ? std::nullopt
+                                 : std::optional(at(offset, "unexpected code after halt"));
+    }
+  }
+
+  return at(offset, "code does not end with halt");
+}
+
+auto jackal::bytecode::write_file(instruction_stream const& code,
+                                  std::filesystem::path const& path) noexcept
+    -> std::optional<load_error>
+{
+  constexpr auto Limit = std::numeric_limits<uint32_t>::max();
+  if (code.register_count() + code.local_count() > file_header::max_frame_slots ||
+      code.constants().size() > Limit)
+  {
+    return load_error("Program is too large to be written as bytecode");
+  }
+
+  file_header header{file_header::magic_number,
+                     file_header::current_version,
+                     file_header::byte_order_mark,
+                     static_cast<uint32_t>(code.register_count()),
+                     static_cast<uint32_t>(code.local_count()),
+                     static_cast<uint32_t>(code.constants().size()),
+                     0,
+                     code.size()};
+
+  std::ofstream output(path, std::ios::binary | std::ios::trunc);
+  output.write(reinterpret_cast<char const*>(&header), sizeof(header));  // NOLINT
+  output.write(reinterpret_cast<char const*>(code.constants().data()),   // NOLINT
+               static_cast<std::streamsize>(code.constants().size() * sizeof(int64_t)));
+  output.write(reinterpret_cast<char const*>(code.code()),  // NOLINT
+               static_cast<std::streamsize>(code.size()));
+  output.close();
+
+  if (!output)
+  {
+    return load_error("Could not write bytecode file '" + path.string() + "'");
+  }
+  return std::nullopt;
+}
+
+auto mapped_file::load(std::filesystem::path const& path) noexcept
+    -> util::Result<mapped_file, load_error>
+{
+  using LoadResult = util::Result<mapped_file, load_error>;
+
+  int fd = ::open(path.c_str(), O_RDONLY | O_CLOEXEC);  // NOLINT
+  if (fd < 0)
+  {
+    return LoadResult::from(load_error("Could not open bytecode file '" + path.string() + "'"));
+  }
+
+  struct stat status
+  {
+  };
+  if (::fstat(fd, &status) != 0 || !S_ISREG(status.st_mode) ||  // NOLINT
+      static_cast<std::size_t>(status.st_size) < sizeof(file_header))
+  {
+    ::close(fd);
+    return LoadResult::from(load_error("'" + path.string() + "' is not a bytecode file"));
+  }
+
+  auto size = static_cast<std::size_t>(status.st_size);
+  void* data = ::mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fd, 0);
+  ::close(fd);
+  if (data == MAP_FAILED)  // NOLINT
+  {
+    return LoadResult::from(load_error("Could not map bytecode file '" + path.string() + "'"));
+  }
+
+  // Owns the mapping from here on, so every early return below unmaps it
+  mapped_file file(static_cast<uint8_t const*>(data), size);
+  auto const& header = file.header();
+  if (header.magic != file_header::magic_number)
+  {
+    return LoadResult::from(load_error("'" + path.string() + "' is not a bytecode file"));
+  }
+  if (header.byte_order != file_header::byte_order_mark)
+  {
+    return LoadResult::from(load_error("'" + path.string() + "' was written on a machine with a "
+                                       "different byte order"));
+  }
+  if (header.version != file_header::current_version)
+  {
+    return LoadResult::from(load_error("'" + path.string() + "' has unsupported version " +
+                                       std::to_string(header.version)));
+  }
+
+  auto constantsSize = static_cast<std::size_t>(header.constant_count) * sizeof(int64_t);
+  if (size - sizeof(file_header) < constantsSize ||
+      size - sizeof(file_header) - constantsSize != header.code_size)
+  {
+    return LoadResult::from(load_error("'" + path.string() + "' is truncated"));
+  }
+
+  if (auto error = verify(file.view()))
+  {
+    return LoadResult::from(std::move(*error));
+  }
+
+  ::madvise(data, size, MADV_WILLNEED);
+  return LoadResult::from(std::move(file));
+}
+
+mapped_file::~mapped_file() noexcept
+{
+  if (_data != nullptr)
+  {
+    ::munmap(const_cast<uint8_t*>(_data), _size);  // NOLINT
+  }
+}
+
+auto mapped_file::view() const noexcept -> code_view
+{
+  auto const& fileHeader = header();
+  auto const* constants = _data + sizeof(file_header);
+  auto const* code = constants + fileHeader.constant_count * sizeof(int64_t);
+  return {code,
+          fileHeader.code_size,
+          reinterpret_cast<int64_t const*>(constants),  // NOLINT
+          fileHeader.constant_count,
+          fileHeader.register_count,
+          fileHeader.local_count};
+}
@@ -0,0 +1,48 @@
+#include "bytecode/decoder.hpp"
+
+#include <cassert>
+#include <cstdint>
+
+using jackal::bytecode::decoded_instruction;
+using jackal::bytecode::decoder;
+using jackal::bytecode::operand;
+
+namespace encoding = jackal::bytecode::encoding;
+
+auto decoder::next() noexcept -> std::optional<decoded_instruction>
+{
+  assert(_offset < _stream.size());
+  auto const* instruction = _stream.code() + _offset;
+  auto op = static_cast<opcode>(instruction[0]);
+  if (op == opcode::halt)
+  {
+    return std::nullopt;
+  }
+
+  decoded_instruction decoded{
+      op,
+      encoding::operand_count(op),
+      {operand::from_register(0), operand::from_register(0), operand::from_register(0)}};
+  for (std::size_t i = 0; i < decoded.operand_count; ++i)
+  {
+    auto value = encoding::read_operand(instruction, i);
+    switch (encoding::encoding_of(instruction[1], i))
+    {
+      case operand_encoding::reg:
+        decoded.operands[i] = operand::from_register(value);
+        break;
+      case operand_encoding::local:
+        decoded.operands[i] = operand::from_local(value);
+        break;
+      case operand_encoding::immediate:
+        decoded.operands[i] = operand::from_constant(static_cast<int32_t>(value));
+        break;
+      case operand_encoding::pool:
+        decoded.operands[i] = operand::from_constant(_stream.constants()[value]);
+        break;
+    }
+  }
+
+  _offset += encoding::instruction_size(op);
+  return decoded;
+}
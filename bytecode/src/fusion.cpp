@@ -0,0 +1,213 @@
+#include "bytecode/fusion.hpp"
+
+#include <array>
+#include <cassert>
+#include <cstdint>
+#include <vector>
+
+#include "bytecode/decoder.hpp"
+#include "bytecode/opcode.hpp"
+
+using jackal::bytecode::decoded_instruction;
+using jackal::bytecode::decoder;
+using jackal::bytecode::instruction_stream;
+using jackal::bytecode::opcode;
+using jackal::bytecode::operand_type;
+
+namespace
+{
+struct instruction
+{
+  decoded_instruction decoded;
+  // Whether each operand is a register that is not read again before it is next written
+  std::array<bool, jackal::bytecode::encoding::max_operands> last_use{};
+};
+
+/// Operand 0 is the destination of every instruction that writes a register
+auto writes_register(decoded_instruction const& instr) noexcept -> bool
+{
+  return instr.op != opcode::print && instr.operand_count > 0 &&
+         instr.operands[0].type() == operand_type::reg;
+}
+
+auto decode(instruction_stream const& code) noexcept -> std::vector<instruction>
+{
+  std::vector<instruction> instructions;
+  instructions.reserve(code.instruction_count());
+  decoder reader(code);
+  while (auto decoded = reader.next())
+  {
+    instructions.push_back({*decoded, {}});
+  }
+
+  // Straight-line code, so one backwards pass computes exact register liveness
+  std::vector<bool> live(code.register_count(), false);
+  for (auto it = instructions.rbegin(); it != instructions.rend(); ++it)
+  {
+    // An instruction that reads and writes the same register is the last use of its old value
+    auto const& decoded = it->decoded;
+    auto firstRead = writes_register(decoded) ? 1U : 0U;
+    if (firstRead == 1)
+    {
+      live[decoded.operands[0].as_register()] = false;
+    }
+    for (auto i = firstRead; i < decoded.operand_count; ++i)
+    {
+      if (decoded.operands[i].type() == operand_type::reg)
+      {
+        it->last_use[i] = !live[decoded.operands[i].as_register()];
+      }
+    }
+    for (auto i = firstRead; i < decoded.operand_count; ++i)
+    {
+      if (decoded.operands[i].type() == operand_type::reg)
+      {
+        live[decoded.operands[i].as_register()] = true;
+      }
+    }
+  }
+  return instructions;
+}
+
+auto is_immediate(decoded_instruction const& instr) noexcept -> bool
+{
+  return instr.op == opcode::constant;
+}
+
+/// @returns whether @p instr only writes a register from a local or an immediate
+auto is_operand(decoded_instruction const& instr) noexcept -> bool
+{
+  return instr.op == opcode::load || is_immediate(instr);
+}
+
+/// @returns whether @p add reads the registers written by @p a and @p b, in that order, for the
+/// last time
+auto consumes(instruction const& add, decoded_instruction const& a,
+              decoded_instruction const& b) noexcept -> bool
+{
+  auto const& operands = add.decoded.operands;
+  return operands[1].as_register() == a.operands[0].as_register() &&
+         operands[2].as_register() == b.operands[0].as_register() && add.last_use[1] &&
+         add.last_use[2];
+}
+
+/// @returns how many instructions starting at @p instructions[index] were fused into one
+auto try_fuse(std::vector<instruction> const& instructions, std::size_t index,
+              instruction_stream& out) noexcept -> std::size_t
+{
+  if (index + 1 >= instructions.size())
+  {
+    return 0;
+  }
+
+  auto const& first = instructions[index].decoded;
+  auto const& second = instructions[index + 1];
+  if (is_immediate(first) && second.decoded.op == opcode::store &&
+      second.decoded.operands[1].as_register() == first.operands[0].as_register() &&
+      second.last_use[1])
+  {
+    out.emit_store_const(second.decoded.operands[0].as_local(),
+                         static_cast<int32_t>(first.operands[1].as_constant()));
+    return 2;
+  }
+
+  if (index + 2 >= instructions.size() || instructions[index + 2].decoded.op != opcode::add)
+  {
+    return 0;
+  }
+
+  auto const& a = first;
+  auto const& b = second.decoded;
+  auto const& add = instructions[index + 2];
+  // The second write must not clobber the first, and both must be consumed by the add alone
+  if (!is_operand(a) || !is_operand(b) ||
+      a.operands[0].as_register() == b.operands[0].as_register())
+  {
+    return 0;
+  }
+
+  auto inOrder = consumes(add, a, b);
+  if (!inOrder && !consumes(add, b, a))
+  {
+    return 0;
+  }
+
+  auto dest = add.decoded.operands[0].as_register();
+  if (a.op == opcode::load && b.op == opcode::load)
+  {
+    auto const& lhs = inOrder ? a : b;
+    auto const& rhs = inOrder ? b : a;
+    out.emit_add_local_local(dest, lhs.operands[1].as_local(), rhs.operands[1].as_local());
+    return 3;
+  }
+
+  if (a.op != b.op)
+  {
+    // Addition commutes, so the constant may have been written before or after the local
+    auto const& constant = is_immediate(a) ? a : b;
+    auto const& load = is_immediate(a) ? b : a;
+    out.emit_add_const_local(dest, static_cast<int32_t>(constant.operands[1].as_constant()),
+                             load.operands[1].as_local());
+    return 3;
+  }
+  return 0;
+}
+
+auto copy(decoded_instruction const& instr, instruction_stream& out) noexcept -> void
+{
+  auto const& operands = instr.operands;
+  switch (instr.op)
+  {
+    case opcode::constant:
+    case opcode::wide_constant:
+      out.emit_constant(operands[0].as_register(), operands[1].as_constant());
+      break;
+    case opcode::add:
+      out.emit_add(operands[0].as_register(), operands[1].as_register(),
+                   operands[2].as_register());
+      break;
+    case opcode::store:
+      out.emit_store(operands[0].as_local(), operands[1].as_register());
+      break;
+    case opcode::load:
+      out.emit_load(operands[0].as_register(), operands[1].as_local());
+      break;
+    case opcode::print:
+      out.emit_print(operands[0].as_register());
+      break;
+    case opcode::add_local_local:
+      out.emit_add_local_local(operands[0].as_register(), operands[1].as_local(),
+                               operands[2].as_local());
+      break;
+    case opcode::add_const_local:
+      out.emit_add_const_local(operands[0].as_register(),
+                               static_cast<int32_t>(operands[1].as_constant()),
+                               operands[2].as_local());
+      break;
+    case opcode::store_const:
+      out.emit_store_const(operands[0].as_local(),
+                           static_cast<int32_t>(operands[1].as_constant()));
+      break;
+    case opcode::halt:
+      assert(false && "the decoder stops at halt");
+      break;
+  }
+}
+}  // namespace
+
+auto jackal::bytecode::fuse(instruction_stream const& code) noexcept -> instruction_stream
+{
+  auto instructions = decode(code);
+  instruction_stream fused;
+  for (std::size_t index = 0; index < instructions.size();)
+  {
+    auto consumed = try_fuse(instructions, index, fused);
+    if (consumed == 0)
+    {
+      copy(instructions[index].decoded, fused);
+      consumed = 1;
+    }
+    index += consumed;
+  }
+  return fused;
+}
@@ -0,0 +1,124 @@
+#include "bytecode/instruction_stream.hpp"
+
+#include <algorithm>
+#include <cassert>
+#include <cstring>
+#include <limits>
+
+using jackal::bytecode::instruction_stream;
+
+namespace encoding = jackal::bytecode::encoding;
+
+auto instruction_stream::emit_constant(uint64_t dest, int64_t value) noexcept -> void
+{
+  using limits = std::numeric_limits<int32_t>;
+  if (value >= limits::min() && value <= limits::max())
+  {
+    emit(opcode::constant, {{operand_encoding::reg, dest},
+                            {operand_encoding::immediate, static_cast<uint32_t>(value)}});
+  }
+  else
+  {
+    emit(opcode::wide_constant,
+         {{operand_encoding::reg, dest}, {operand_encoding::pool, pool(value)}});
+  }
+}
+
+auto instruction_stream::emit_add(uint64_t dest, uint64_t src0, uint64_t src1) noexcept -> void
+{
+  emit(opcode::add, {{operand_encoding::reg, dest},
+                     {operand_encoding::reg, src0},
+                     {operand_encoding::reg, src1}});
+}
+
+auto instruction_stream::emit_store(uint64_t dest, uint64_t src) noexcept -> void
+{
+  emit(opcode::store, {{operand_encoding::local, dest}, {operand_encoding::reg, src}});
+}
+
+auto instruction_stream::emit_load(uint64_t dest, uint64_t src) noexcept -> void
+{
+  emit(opcode::load, {{operand_encoding::reg, dest}, {operand_encoding::local, src}});
+}
+
+auto instruction_stream::emit_print(uint64_t src) noexcept -> void
+{
+  emit(opcode::print, {{operand_encoding::reg, src}});
+}
+
+auto instruction_stream::emit_add_local_local(uint64_t dest, uint64_t src0, uint64_t src1) noexcept
+    -> void
+{
+  emit(opcode::add_local_local, {{operand_encoding::reg, dest},
+                                 {operand_encoding::local, src0},
+                                 {operand_encoding::local, src1}});
+}
+
+auto instruction_stream::emit_add_const_local(uint64_t dest, int32_t value, uint64_t src) noexcept
+    -> void
+{
+  emit(opcode::add_const_local, {{operand_encoding::reg, dest},
+                                 {operand_encoding::immediate, static_cast<uint32_t>(value)},
+                                 {operand_encoding::local, src}});
+}
+
+auto instruction_stream::emit_store_const(uint64_t dest, int32_t value) noexcept -> void
+{
+  emit(opcode::store_const, {{operand_encoding::local, dest},
+                             {operand_encoding::immediate, static_cast<uint32_t>(value)}});
+}
+
+auto instruction_stream::emit(opcode op, std::initializer_list<encoded_operand> operands) noexcept
+    -> void
+{
+  // Overwrite the terminating halt, which is re-appended after the new instruction
+  _code.resize(_code.size() - encoding::instruction_size(opcode::halt));
+  append(op, operands);
+  append(opcode::halt, {});
+  --_instructions;
+}
+
+auto instruction_stream::append(opcode op, std::initializer_list<encoded_operand> operands) noexcept
+    -> void
+{
+  assert(operands.size() == encoding::operand_count(op));
+
+  uint8_t encodings = 0;
+  auto index = 0U;
+  for (auto [type, value] : operands)
+  {
+    encodings |= static_cast<uint8_t>(static_cast<unsigned>(type)
+                                      << (index++ * encoding::operand_encoding_bits));
+    if (type == operand_encoding::reg)
+    {
+      _registers = std::max<std::size_t>(_registers, value + 1);
+    }
+    else if (type == operand_encoding::local)
+    {
+      _locals = std::max<std::size_t>(_locals, value + 1);
+    }
+  }
+
+  assert(encodings == encoding::operand_encodings(op));
+  _code.push_back(static_cast<uint8_t>(op));
+  _code.push_back(encodings);
+  for (auto [type, value] : operands)
+  {
+    assert(value <= std::numeric_limits<uint32_t>::max());
+    auto narrow = static_cast<uint32_t>(value);
+    auto offset = _code.size();
+    _code.resize(offset + encoding::operand_size);
+    std::memcpy(_code.data() + offset, &narrow, sizeof(narrow));
+  }
+  ++_instructions;
+}
+
+auto instruction_stream::pool(int64_t value) noexcept -> uint32_t
+{
+  auto [it, inserted] = _pool.try_emplace(value, static_cast<uint32_t>(_constants.size()));
+  if (inserted)
+  {
+    _constants.push_back(value);
+  }
+  return it->second;
+}
@@ -0,0 +1,267 @@
+#include "bytecode/jit.hpp"
+
+#include <cstring>
+#include <initializer_list>
+#include <limits>
+#include <utility>
+#include <vector>
+
+#include "bytecode/encoding.hpp"
+#include "bytecode/opcode.hpp"
+
+#if JACKAL_JIT_X86_64
+#include <sys/mman.h>
+#include <unistd.h>
+#endif
+
+using jackal::bytecode::frame_layout;
+using jackal::bytecode::native_code;
+
+namespace encoding = jackal::bytecode::encoding;
+
+#if JACKAL_JIT_X86_64
+namespace
+{
+/**
+ * Emits the handful of x86-64 instructions the templates are made of.
+ *
+ * Throughout the generated code rbx holds the frame, r12 the output file and r13 the address of
+ * vm::print; all three are callee-saved so they survive the calls to it. rax is the only scratch
+ * register. Slots are addressed as [rbx + disp], using a one byte displacement wherever it fits
+ * since straight-line code is bound by how fast the processor can fetch it.
+ */
+struct assembler
+{
+  // The reg field of a ModRM byte
+  static constexpr uint8_t rax = 0;
+  static constexpr uint8_t rsi = 6;
+
+  void bytes(std::initializer_list<uint8_t> values) { code.insert(code.end(), values); }
+
+  template <typename T>
+  void value(T value)
+  {
+    auto offset = code.size();
+    code.resize(offset + sizeof(value));
+    std::memcpy(code.data() + offset, &value, sizeof(value));
+  }
+
+  /// Emits the ModRM byte and displacement of [rbx + slot] with @p reg in the reg field
+  void slot(uint8_t reg, int32_t slot)
+  {
+    constexpr uint8_t rbx = 3;
+    if (slot >= std::numeric_limits<int8_t>::min() && slot <= std::numeric_limits<int8_t>::max())
+    {
+      bytes({static_cast<uint8_t>(0x40 | reg << 3 | rbx)});
+      value(static_cast<int8_t>(slot));
+    }
+    else
+    {
+      bytes({static_cast<uint8_t>(0x80 | reg << 3 | rbx)});
+      value(slot);
+    }
+  }
+
+  void prologue()
+  {
+    // Three pushes and the return address keep the stack 16-byte aligned for calls
+    bytes({0x53});              // push rbx
+    bytes({0x41, 0x54});        // push r12
+    bytes({0x41, 0x55});        // push r13
+    bytes({0x48, 0x89, 0xfb});  // mov rbx, rdi
+    bytes({0x49, 0x89, 0xf4});  // mov r12, rsi
+    bytes({0x49, 0xbd});        // movabs r13, imm64
+    value(reinterpret_cast<uint64_t>(&jackal::bytecode::vm::print));  // NOLINT
+  }
+
+  void epilogue()
+  {
+    bytes({0x41, 0x5d});  // pop r13
+    bytes({0x41, 0x5c});  // pop r12
+    bytes({0x5b});        // pop rbx
+    bytes({0xc3});        // ret
+  }
+
+  /// mov rax, [slot]
+  void load_rax(int32_t from)
+  {
+    bytes({0x48, 0x8b});
+    slot(rax, from);
+  }
+
+  /// add rax, [slot]
+  void add_rax(int32_t from)
+  {
+    bytes({0x48, 0x03});
+    slot(rax, from);
+  }
+
+  /// add rax, imm32
+  void add_rax_immediate(int32_t immediate)
+  {
+    bytes({0x48, 0x05});
+    value(immediate);
+  }
+
+  /// mov [slot], rax
+  void store_rax(int32_t to)
+  {
+    bytes({0x48, 0x89});
+    slot(rax, to);
+  }
+
+  /// mov qword [slot], imm32 (sign-extended)
+  void store_immediate(int32_t to, int32_t immediate)
+  {
+    bytes({0x48, 0xc7});
+    slot(rax, to);
+    value(immediate);
+  }
+
+  /// movabs rax, imm64
+  void move_rax(uint64_t immediate)
+  {
+    bytes({0x48, 0xb8});
+    value(immediate);
+  }
+
+  /// vm::print(output, [slot])
+  void print(int32_t from)
+  {
+    bytes({0x4c, 0x89, 0xe7});  // mov rdi, r12
+    bytes({0x48, 0x8b});        // mov rsi, [slot]
+    slot(rsi, from);
+    bytes({0x41, 0xff, 0xd5});  // call r13
+  }
+
+  std::vector<uint8_t> code;
+};
+
+auto translate(jackal::bytecode::code_view const& code, frame_layout const& layout)
+    -> std::vector<uint8_t>
+{
+  using jackal::bytecode::opcode;
+
+  auto reg = [](uint32_t index) { return static_cast<int32_t>(index * sizeof(int64_t)); };
+  auto local = [&layout](uint32_t index)
+  {
+    return static_cast<int32_t>((layout.locals_offset() + index) * sizeof(int64_t));
+  };
+  auto immediate = [](uint32_t operand) { return static_cast<int32_t>(operand); };
+
+  assembler out;
+  out.code.reserve(code.size * 4);
+  out.prologue();
+  for (auto const* pc = code.code;; pc += encoding::instruction_size(static_cast<opcode>(*pc)))
+  {
+    auto operand = [pc](std::size_t index) { return encoding::read_operand(pc, index); };
+    switch (static_cast<opcode>(*pc))
+    {
+      case opcode::constant:
+        out.store_immediate(reg(operand(0)), immediate(operand(1)));
+        break;
+      case opcode::wide_constant:
+        out.move_rax(static_cast<uint64_t>(code.constants[operand(1)]));
+        out.store_rax(reg(operand(0)));
+        break;
+      case opcode::add:
+        out.load_rax(reg(operand(1)));
+        out.add_rax(reg(operand(2)));
+        out.store_rax(reg(operand(0)));
+        break;
+      case opcode::store:
+        out.load_rax(reg(operand(1)));
+        out.store_rax(local(operand(0)));
+        break;
+      case opcode::load:
+        out.load_rax(local(operand(1)));
+        out.store_rax(reg(operand(0)));
+        break;
+      case opcode::print:
+        out.print(reg(operand(0)));
+        break;
+      case opcode::add_local_local:
+        out.load_rax(local(operand(1)));
+        out.add_rax(local(operand(2)));
+        out.store_rax(reg(operand(0)));
+        break;
+      case opcode::add_const_local:
+        out.load_rax(local(operand(2)));
+        out.add_rax_immediate(immediate(operand(1)));
+        out.store_rax(reg(operand(0)));
+        break;
+      case opcode::store_const:
+        out.store_immediate(local(operand(0)), immediate(operand(1)));
+        break;
+      case opcode::halt:
+        out.epilogue();
+        return std::move(out.code);
+    }
+  }
+}
+}  // namespace
+#endif
+
+auto native_code::compile([[maybe_unused]] code_view const& code) noexcept
+    -> std::optional<native_code>
+{
+#if JACKAL_JIT_X86_64
+  frame_layout layout(code);
+  if (layout.size() > std::numeric_limits<int32_t>::max() / sizeof(int64_t))
+  {
+    return std::nullopt;
+  }
+
+  auto machineCode = translate(code, layout);
+  auto page = static_cast<std::size_t>(::sysconf(_SC_PAGESIZE));
+  auto mapped = (machineCode.size() + page - 1) / page * page;
+  void* memory =
+      ::mmap(nullptr, mapped, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+  if (memory == MAP_FAILED)  // NOLINT
+  {
+    return std::nullopt;
+  }
+
+  std::memcpy(memory, machineCode.data(), machineCode.size());
+  if (::mprotect(memory, mapped, PROT_READ | PROT_EXEC) != 0)
+  {
+    ::munmap(memory, mapped);
+    return std::nullopt;
+  }
+  return native_code(memory, mapped, machineCode.size(), layout);
+#else
+  return std::nullopt;
+#endif
+}
+
+native_code::~native_code() noexcept
+{
+#if JACKAL_JIT_X86_64
+  if (_memory != nullptr)
+  {
+    ::munmap(_memory, _mapped);
+  }
+#endif
+}
+
+native_code::native_code(native_code&& other) noexcept
+    : _memory(std::exchange(other._memory, nullptr)),
+      _mapped(std::exchange(other._mapped, 0)),
+      _size(std::exchange(other._size, 0)),
+      _layout(other._layout)
+{
+}
+
+auto native_code::operator=(native_code&& other) noexcept -> native_code&
+{
+  std::swap(_memory, other._memory);
+  std::swap(_mapped, other._mapped);
+  std::swap(_size, other._size);
+  std::swap(_layout, other._layout);
+  return *this;
+}
+
+auto native_code::operator()(int64_t* frame, std::FILE* output) const noexcept -> void
+{
+  reinterpret_cast<entry_point>(_memory)(frame, output);  // NOLINT
+}
@@ -0,0 +1,65 @@
+#include "bytecode/profile.hpp"
+
+#include <algorithm>
+#include <cassert>
+
+using jackal::bytecode::dispatch_profile;
+using jackal::bytecode::opcode_sequence;
+
+namespace encoding = jackal::bytecode::encoding;
+
+auto dispatch_profile::record(code_view const& code, uint64_t runs) noexcept -> void
+{
+  // The two opcodes dispatched before the current one, or N before the first dispatch
+  std::size_t previous = N;
+  std::size_t beforePrevious = N;
+  for (auto const* pc = code.code; *pc != static_cast<uint8_t>(opcode::halt);
+       pc += encoding::instruction_size(static_cast<opcode>(*pc)))
+  {
+    assert(*pc < N);
+    std::size_t current = *pc;
+    _dispatches += runs;
+    if (previous != N)
+    {
+      _pairs[previous * N + current] += runs;
+    }
+    if (beforePrevious != N)
+    {
+      _triples[(beforePrevious * N + previous) * N + current] += runs;
+    }
+    beforePrevious = previous;
+    previous = current;
+  }
+}
+
+auto dispatch_profile::hottest(std::size_t length, std::size_t limit) const noexcept
+    -> std::vector<opcode_sequence>
+{
+  assert(length == 2 || length == 3);
+  auto const* counts = length == 2 ? _pairs.data() : _triples.data();
+  auto size = length == 2 ? _pairs.size() : _triples.size();
+
+  std::vector<opcode_sequence> sequences;
+  for (std::size_t index = 0; index < size; ++index)
+  {
+    if (counts[index] == 0)
+    {
+      continue;
+    }
+
+    opcode_sequence sequence{{}, length, counts[index]};
+    auto remaining = index;
+    for (auto i = length; i-- > 0;)
+    {
+      sequence.ops[i] = static_cast<opcode>(remaining % N);
+      remaining /= N;
+    }
+    sequences.push_back(sequence);
+  }
+
+  // Stable, so that equally frequent sequences stay in opcode order
+  std::stable_sort(sequences.begin(), sequences.end(),
+                   [](auto const& a, auto const& b) { return a.count > b.count; });
+  sequences.resize(std::min(limit, sequences.size()));
+  return sequences;
+}
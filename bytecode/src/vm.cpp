@@ -1 +1,174 @@
 #include "bytecode/vm.hpp"
+
+#include <array>
+#include <charconv>
+#include <cstdint>
+#include <iterator>
+#include <limits>
+
+#include "bytecode/encoding.hpp"
+#include "bytecode/jit.hpp"
+#include "bytecode/opcode.hpp"
+
+#if (defined(__GNUC__) || defined(__clang__)) && !defined(JACKAL_VM_SWITCH_DISPATCH)
+#define JACKAL_VM_COMPUTED_GOTO 1
+#else
+#define JACKAL_VM_COMPUTED_GOTO 0
+#endif
+
+using jackal::bytecode::vm;
+
+namespace encoding = jackal::bytecode::encoding;
+
+namespace
+{
+/// Adds as the C backend and constant folding do, wrapping on overflow rather than invoking
+/// undefined behaviour
+constexpr auto wrapping_add(int64_t a, int64_t b) noexcept -> int64_t
+{
+  return static_cast<int64_t>(static_cast<uint64_t>(a) + static_cast<uint64_t>(b));
+}
+}  // namespace
+
+auto vm::print(std::FILE* output, int64_t value) noexcept -> void
+{
+  std::array<char, std::numeric_limits<int64_t>::digits10 + 3> buffer;  // NOLINT
+  auto [last, ec] = std::to_chars(buffer.data(), buffer.data() + buffer.size() - 1, value);
+  *last++ = '\n';
+  std::fwrite(buffer.data(), 1, last - buffer.data(), output);
+}
+
+auto vm::run(native_code const& code, std::FILE* output) noexcept -> void
+{
+  _frame.assign(code.layout().size(), 0);
+  _locals = code.layout().locals_offset();
+  code(_frame.data(), output);
+}
+
+auto vm::run_native(code_view const& code, std::FILE* output) noexcept -> void
+{
+  if (auto native = native_code::compile(code))
+  {
+    run(*native, output);
+    return;
+  }
+  run(code, output);
+}
+
+// Handlers read the operands their opcode is known to take and advance pc past the instruction.
+#if JACKAL_VM_COMPUTED_GOTO
+#define VM_CASE(op) op_##op
+#define VM_DISPATCH() goto* labels[*pc]  // NOLINT
+#else
+#define VM_CASE(op) case opcode::op
+#define VM_DISPATCH() continue
+#endif
+
+#define VM_OPERAND(index) encoding::read_operand(pc, index)
+#define VM_NEXT(op) pc += encoding::instruction_size(opcode::op)
+
+auto vm::run(code_view const& code, std::FILE* output) noexcept -> void
+{
+  frame_layout layout(code);
+  _frame.assign(layout.size(), 0);
+  _locals = layout.locals_offset();
+
+  auto* registers = _frame.data() + frame_layout::registers_offset;
+  auto* locals = _frame.data() + layout.locals_offset();
+  auto const* constants = code.constants;
+  auto const* pc = code.code;
+
+#if JACKAL_VM_COMPUTED_GOTO
+  // Indexed by opcode value
+  static void* const labels[] = {&&op_constant,      &&op_add,             &&op_store,  // NOLINT
+                                 &&op_load,          &&op_print,           &&op_halt,
+                                 &&op_wide_constant, &&op_add_local_local, &&op_add_const_local,
+                                 &&op_store_const};
+  static_assert(std::size(labels) == encoding::opcode_count);
+  VM_DISPATCH();
+#else
+  for (;;)
+  {
+    switch (static_cast<opcode>(*pc))
+    {
+#endif
+
+  VM_CASE(constant) :
+  {
+    registers[VM_OPERAND(0)] = static_cast<int32_t>(VM_OPERAND(1));
+    VM_NEXT(constant);
+    VM_DISPATCH();
+  }
+
+  VM_CASE(wide_constant) :
+  {
+    registers[VM_OPERAND(0)] = constants[VM_OPERAND(1)];
+    VM_NEXT(wide_constant);
+    VM_DISPATCH();
+  }
+
+  VM_CASE(add) :
+  {
+    registers[VM_OPERAND(0)] = wrapping_add(registers[VM_OPERAND(1)], registers[VM_OPERAND(2)]);
+    VM_NEXT(add);
+    VM_DISPATCH();
+  }
+
+  VM_CASE(store) :
+  {
+    locals[VM_OPERAND(0)] = registers[VM_OPERAND(1)];
+    VM_NEXT(store);
+    VM_DISPATCH();
+  }
+
+  VM_CASE(load) :
+  {
+    registers[VM_OPERAND(0)] = locals[VM_OPERAND(1)];
+    VM_NEXT(load);
+    VM_DISPATCH();
+  }
+
+  VM_CASE(print) :
+  {
+    print(output, registers[VM_OPERAND(0)]);
+    VM_NEXT(print);
+    VM_DISPATCH();
+  }
+
+  VM_CASE(add_local_local) :
+  {
+    registers[VM_OPERAND(0)] = wrapping_add(locals[VM_OPERAND(1)], locals[VM_OPERAND(2)]);
+    VM_NEXT(add_local_local);
+    VM_DISPATCH();
+  }
+
+  VM_CASE(add_const_local) :
+  {
+    registers[VM_OPERAND(0)] =
+        wrapping_add(static_cast<int32_t>(VM_OPERAND(1)), locals[VM_OPERAND(2)]);
+    VM_NEXT(add_const_local);
+    VM_DISPATCH();
+  }
+
+  VM_CASE(store_const) :
+  {
+    locals[VM_OPERAND(0)] = static_cast<int32_t>(VM_OPERAND(1));
+    VM_NEXT(store_const);
+    VM_DISPATCH();
+  }
+
+  VM_CASE(halt) :
+  {
+    return;
+  }
+
+#if !JACKAL_VM_COMPUTED_GOTO
+    }
+  }
+#endif
+}
+
+#undef VM_CASE
+#undef VM_DISPATCH
+#undef VM_OPERAND
+#undef VM_NEXT
@@ -0,0 +1,81 @@
+/// @file Reports the opcode pairs and triples that the vm dispatches most often.
+///
+/// Usage: jackal_bytecode_profile FILE.jkb... [--top N]
+///
+/// Each bytecode file, as written by `jackal --bytecode`, is loaded and recorded once. The N most
+/// frequent sequences (10 by default) are printed with their share of all dispatches; sequences
+/// near the top that are not yet superinstructions are the candidates to fuse next.
+#include <cstddef>
+#include <cstdint>
+#include <iomanip>
+#include <iostream>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "bytecode/bytecode_file.hpp"
+#include "bytecode/opcode.hpp"
+#include "bytecode/profile.hpp"
+
+using jackal::bytecode::dispatch_profile;
+using jackal::bytecode::mapped_file;
+
+namespace
+{
+auto report(dispatch_profile const& profile, std::size_t length, std::size_t limit) -> void
+{
+  std::cout << (length == 2 ? "hottest pairs:" : "hottest triples:") << std::endl;
+  for (auto const& sequence : profile.hottest(length, limit))
+  {
+    auto share = 100.0 * static_cast<double>(sequence.count) /
+                 static_cast<double>(profile.dispatches());
+    std::cout << std::setw(12) << sequence.count << std::setw(7) << std::fixed
+              << std::setprecision(1) << share << "%  ";
+    for (std::size_t i = 0; i < sequence.length; ++i)
+    {
+      std::cout << (i == 0 ? "" : " ") << jackal::bytecode::name(sequence.ops[i]);
+    }
+    std::cout << std::endl;
+  }
+}
+}  // namespace
+
+auto main(int argc, char** argv) -> int
+{
+  std::vector<std::string_view> paths;
+  std::size_t limit = 10;
+  for (auto i = 1; i < argc; ++i)
+  {
+    std::string_view argument = argv[i];  // NOLINT
+    if (argument == "--top" && i + 1 < argc)
+    {
+      limit = std::stoul(argv[++i]);  // NOLINT
+    }
+    else
+    {
+      paths.push_back(argument);
+    }
+  }
+
+  if (paths.empty())
+  {
+    std::cerr << "Usage: jackal_bytecode_profile FILE.jkb... [--top N]" << std::endl;
+    return 1;
+  }
+
+  dispatch_profile profile;
+  for (auto path : paths)
+  {
+    auto file = mapped_file::load(path);
+    if (file.is_err())
+    {
+      std::cerr << file.err().message() << std::endl;
+      return 1;
+    }
+    profile.record(file->view());
+  }
+
+  std::cout << profile.dispatches() << " dispatches" << std::endl;
+  report(profile, 2, limit);
+  report(profile, 3, limit);
+}
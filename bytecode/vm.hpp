@@ -1,24 +1,93 @@
 #pragma once
 
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <span>
 #include <vector>
 
-#include "bytecode/reg.hpp"
+#include "bytecode/code_view.hpp"
+#include "bytecode/instruction_stream.hpp"
 
 namespace jackal::bytecode
 {
-// Phase 1 requires:
-// * Registers
-// * Locals
-//
-// Everything can be typed as 64-bit signed integers.
-// No functions yet, so all memory can be globally scoped.
+/**
+ * The layout of the frame that a program executes in: one contiguous block of 64-bit slots, with
+ * the registers first and the locals immediately after them.
+ *
+ * Every slot holds a signed 64-bit integer, so registers and locals need no per-slot metadata;
+ * operands index directly into their half of the frame. With no functions yet, a program has
+ * exactly one frame. Calls would give each activation a frame of this shape on a shared stack.
+ */
+struct frame_layout
+{
+  explicit constexpr frame_layout(code_view const& code) noexcept
+      : register_count(code.register_count), local_count(code.local_count)
+  {
+  }
+
+  static constexpr std::size_t registers_offset = 0;
+
+  [[nodiscard]] constexpr std::size_t locals_offset() const noexcept { return register_count; }
+
+  [[nodiscard]] constexpr std::size_t size() const noexcept
+  {
+    return register_count + local_count;
+  }
+
+  std::size_t register_count;
+  std::size_t local_count;
+};
+
+struct native_code;
+
 struct vm
 {
+  /**
+   * Executes encoded instructions from the first instruction until it halts.
+   *
+   * The code must end with a halt and reference only the registers, locals and constants that the
+   * view declares; instruction_stream guarantees this by construction and bytecode files are
+   * verified when loaded.
+   *
+   * The frame is sized from the view and zeroed before execution begins; locals keep their final
+   * values afterwards so they can be inspected.
+   *
+   * Instructions are dispatched by threading through a table of label addresses when compiled by
+   * GCC or Clang, and through a switch otherwise. Defining JACKAL_VM_SWITCH_DISPATCH forces the
+   * switch.
+   *
+   * @param code the instructions to execute
+   * @param output the file that print instructions write to, one decimal value per line
+   */
+  void run(code_view const& code, std::FILE* output) noexcept;
+
+  void run(instruction_stream const& code, std::FILE* output) noexcept { run(code.view(), output); }
+
+  /// @brief Executes code compiled by the JIT in the same frame that run() would use
+  void run(native_code const& code, std::FILE* output) noexcept;
+
+  /**
+   * Compiles @p code with the JIT and executes the result, or interprets @p code with run() when
+   * the JIT does not support the host.
+   *
+   * Worthwhile for long-running programs, where compiling once costs less than dispatching every
+   * instruction; see native_code.
+   */
+  void run_native(code_view const& code, std::FILE* output) noexcept;
+
+  /// @brief Writes @p value to @p output as a print instruction does, as a decimal line
+  static void print(std::FILE* output, int64_t value) noexcept;
+
+  /// @returns the locals of the last program run, indexed as in its local operands
+  std::span<int64_t const> locals() const noexcept
+  {
+    return std::span(_frame).subspan(_locals, _frame.size() - _locals);
+  }
+
  private:
-  std::vector<reg> _registers;
-  // For phase 1, registers and locals have identical structure.
-  // Beyond "everything is long", this will require different storage,
-  // but for now this is just convenient re-use.
-  std::vector<reg> _locals;
+  // Reused across runs, so repeated runs of similar programs do not allocate
+  std::vector<int64_t> _frame;
+  std::size_t _locals = 0;
 };
 }  // namespace jackal::bytecode
@@ -1,8 +1,11 @@
 #pragma once
 
 #include <filesystem>
+#include <optional>
 #include <string>
 
+#include "codegen/optimization_profile.hpp"
+
 namespace jackal::cli
 {
 struct Options
@@ -13,8 +16,31 @@ struct Options
 
   [[nodiscard]] std::filesystem::path const& output_directory() const noexcept;
 
+  /// @returns true if the program should be run in the bytecode VM instead of compiled
+  [[nodiscard]] bool run() const noexcept { return _run; }
+
+  /// @returns true if the program should be written to a .jkb bytecode file instead of compiled
+  [[nodiscard]] bool bytecode() const noexcept { return _bytecode; }
+
+  /// @returns true if programs run in the VM should be compiled to native code where supported
+  [[nodiscard]] bool jit() const noexcept { return _jit; }
+
+  /// @returns how much effort the C compiler should spend optimizing compiled executables
+  [[nodiscard]] codegen::OptimizationProfile profile() const noexcept { return _profile; }
+
+  /// @returns the directory in which compiled executables are cached, if caching is enabled
+  [[nodiscard]] std::optional<std::filesystem::path> const& cache_directory() const noexcept
+  {
+    return _cacheDirectory;
+  }
+
  private:
   std::string _filePath;
   std::filesystem::path _outputDirectory;
+  bool _run = false;
+  bool _bytecode = false;
+  bool _jit = false;
+  codegen::OptimizationProfile _profile = codegen::OptimizationProfile::Debug;
+  std::optional<std::filesystem::path> _cacheDirectory;
 };
 }  // namespace jackal::cli
@@ -1,42 +1,144 @@
 #include "cli/driver.hpp"
 
+#include <fcntl.h>
+#include <unistd.h>
+
+#include <cstdio>
 #include <cstdlib>
 #include <filesystem>
 #include <iostream>
+#include <memory>
 
+#include "ast/arena.hpp"
+#include "ast/constant_folding.hpp"
+#include "ast/liveness.hpp"
+#include "ast/program.hpp"
+#include "bytecode/bytecode_file.hpp"
+#include "bytecode/fusion.hpp"
+#include "bytecode/vm.hpp"
 #include "cli/options.hpp"
+#include "codegen/bytecode/bytecode_visitor.hpp"
 #include "codegen/c/c_visitor.hpp"
+#include "codegen/compile_cache.hpp"
 #include "codegen/executable.hpp"
+#include "lexer/stream_source.hpp"
 #include "parser/include.hpp"
 #include "parser/parse.hpp"
 #include "util/exit.hpp"
-#include "util/file_system.hpp"
+#include "util/interner.hpp"
 #include "util/result.hpp"
+#include "util/source_buffer.hpp"
 
 using jackal::cli::Driver;
 
+namespace
+{
+auto run(jackal::cli::Options const& options, jackal::bytecode::code_view const& code) -> void
+{
+  jackal::bytecode::vm machine;
+  if (options.jit())
+  {
+    machine.run_native(code, stdout);
+  }
+  else
+  {
+    machine.run(code, stdout);
+  }
+}
+}  // namespace
+
 Driver::Driver(Options const& options) noexcept
 {
   std::filesystem::path filePath(options.file_path());
-  auto file = util::read_file(filePath);
-  if (!file.has_value())
+  // Bytecode files are verified and run in place, skipping the front end entirely
+  if (filePath.extension() == ".jkb")
+  {
+    auto loaded = bytecode::mapped_file::load(filePath);
+    if (loaded.is_err())
+    {
+      std::cerr << loaded.err().message() << std::endl;
+      std::exit(util::ExitInvalidBytecode);
+    }
+
+    run(options, loaded->view());
+    return;
+  }
+
+  // Regular files are lexed directly from a mapping; anything else, such as a pipe, is streamed
+  auto mapped = util::SourceBuffer::map(filePath);
+  int fd = mapped.has_value() ? -1 : ::open(filePath.c_str(), O_RDONLY | O_CLOEXEC);  // NOLINT
+  if (!mapped.has_value() && fd < 0)
   {
     std::cerr << "Could not read source file '" << filePath << "'" << std::endl;
     std::exit(util::ExitMissingSource);
   }
 
-  parser::Parser parser(file->c_str());
-  auto parseResult = parser.parse_program();
+  ast::Arena arena;
+  util::Interner interner;
+  auto parseResult = [&] {
+    if (mapped.has_value())
+    {
+      return parser::Parser(arena, interner, mapped->data()).parse_program();
+    }
+
+    lexer::StreamSource source(fd);
+    auto result = parser::Parser(arena, interner, source).parse_program();
+    ::close(fd);
+    if (source.failed())
+    {
+      std::cerr << "Could not read source file '" << filePath << "'" << std::endl;
+      std::exit(util::ExitMissingSource);
+    }
+    return result;
+  }();
   if (parseResult.is_err())
   {
     parseResult.err().print();
     std::exit(util::ExitSyntaxError);
   }
 
-  codegen::c::CVisitor codeGenerator(filePath.stem());
-  parseResult->accept(codeGenerator);
+  auto program = parseResult.consume_ok();
+  ast::fold_constants(arena, program);
+  ast::eliminate_dead_bindings(program);
+
+  if (options.run() || options.bytecode())
+  {
+    codegen::bytecode::BytecodeVisitor bytecodeGenerator;
+    program.accept(bytecodeGenerator);
+    if (auto const& error = bytecodeGenerator.error())
+    {
+      std::cerr << "Failed to generate bytecode: " << error->message() << std::endl;
+      std::exit(util::ExitCodeGenerationFailed);
+    }
+    auto code = bytecode::fuse(bytecodeGenerator.code());
+
+    if (options.bytecode())
+    {
+      auto bytecodePath = options.output_directory() / filePath.stem().concat(".jkb");
+      if (auto error = bytecode::write_file(code, bytecodePath))
+      {
+        std::cerr << error->message() << std::endl;
+        std::exit(util::ExitCodeGenerationFailed);
+      }
+    }
 
-  auto executable = codeGenerator.generate();
+    if (options.run())
+    {
+      run(options, code.view());
+    }
+    return;
+  }
+
+  codegen::c::CVisitor codeGenerator(filePath.stem(), interner);
+  codeGenerator.set_precompute_output(true);
+  program.accept(codeGenerator);
+
+  auto executable = codeGenerator.generate(options.profile());
+  if (options.cache_directory().has_value())
+  {
+    executable.set_compiler(std::make_shared<codegen::CachingCCompiler>(
+        executable.compiler(), codegen::CompileCache(*options.cache_directory())));
+  }
   auto executablePath = executable.compile();
   if (!executablePath.has_value())
   {
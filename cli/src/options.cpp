@@ -20,7 +20,12 @@ Options::Options(int argc, char** argv) noexcept
   options.add_options()
     ("h,help", "Print usage")
     ("o,outputDir", "The compilation output directory", cxxopts::value<std::string>()->default_value(std::filesystem::current_path()))
-    ("filePath", "The jackal source file to compile", cxxopts::value<std::string>());
+    ("r,run", "Run the program in the bytecode VM instead of compiling an executable")
+    ("b,bytecode", "Write the program to a .jkb bytecode file in the output directory")
+    ("j,jit", "Compile programs run in the VM to native code where supported")
+    ("O,profile", "The optimization profile of the executable: debug, release or release-native", cxxopts::value<std::string>()->default_value("debug"))
+    ("cache-dir", "Reuse executables compiled from identical C source, cached in this directory", cxxopts::value<std::string>())
+    ("filePath", "The jackal source or .jkb file to compile", cxxopts::value<std::string>());
 
   options.parse_positional({"filePath"});
 
@@ -38,6 +43,21 @@ Options::Options(int argc, char** argv) noexcept
 
     _outputDirectory = std::filesystem::path(result["outputDir"].as<std::string>());
     _filePath = result["filePath"].as<std::string>();
+    _run = result.count("run") > 0;
+    _bytecode = result.count("bytecode") > 0;
+    _jit = result.count("jit") > 0;
+    auto profileName = result["profile"].as<std::string>();
+    auto profile = codegen::parse_optimization_profile(profileName);
+    if (!profile.has_value())
+    {
+      std::cerr << "Unknown optimization profile '" << profileName << "'" << std::endl;
+      std::exit(util::ExitInvalidArguments);
+    }
+    _profile = *profile;
+    if (result.count("cache-dir") > 0)
+    {
+      _cacheDirectory.emplace(result["cache-dir"].as<std::string>());
+    }
   }
   catch (cxxopts::OptionException const& ex)
   {
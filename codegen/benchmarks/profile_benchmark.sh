@@ -0,0 +1,60 @@
+#!/bin/bash
+
+if [ "$1" == "--help" ]; then
+    echo "profile_benchmark.sh - Compare generated programs compiled with each optimization profile"
+    echo
+    echo "Usage: profile_benchmark.sh [RESOURCE_DIR] [REPETITIONS] [RUNS]"
+    echo
+    echo "Every RESOURCE_DIR/NAME.c (the C backend's output for NAME.jkl, tests/resources by"
+    echo "default) has the body of main repeated REPETITIONS times, each copy in its own block, so"
+    echo "that it runs long enough to measure. The program is compiled with the flags of each"
+    echo "profile and run RUNS times with its output discarded."
+    echo
+    echo "The compiler is clang, as used by Executable, unless overridden by setting CC."
+    exit 0
+fi
+
+cd "$(dirname "$0")/../.." || exit 255
+
+RESOURCES=${1:-tests/resources}
+REPETITIONS=${2:-2000}
+RUNS=${3:-200}
+CC=${CC:-clang}
+
+# Keep in sync with c_flags() in codegen/src/optimization_profile.cpp
+PROFILES=("debug" "release" "release-native")
+FLAGS=("-O0 -g" "-O2" "-O3 -march=native -flto")
+
+WORK=$(mktemp -d)
+trap 'rm -rf "$WORK"' EXIT
+
+TIMEFORMAT=%R
+printf "%-20s %-16s %12s %12s %10s\n" "program" "profile" "compile (s)" "run (s)" "size (B)"
+
+for source in "$RESOURCES"/*.c; do
+    name=$(basename "$source" .c)
+
+    awk -v repetitions="$REPETITIONS" '
+        /^int main/ { print; in_main = 1; next }
+        in_main && /^}/ {
+            for (i = 0; i < repetitions; ++i) { print "{"; printf "%s", body; print "}" }
+            print; in_main = 0; next
+        }
+        in_main { body = body $0 "\n"; next }
+        { print }
+    ' "$source" > "$WORK/$name.c"
+
+    for i in "${!PROFILES[@]}"; do
+        executable="$WORK/$name.${PROFILES[$i]}.out"
+        # shellcheck disable=SC2086
+        compile=$( { time $CC ${FLAGS[$i]} "$WORK/$name.c" -o "$executable" 2>/dev/null; } 2>&1 )
+        if [ ! -x "$executable" ]; then
+            printf "%-20s %-16s %12s\n" "$name" "${PROFILES[$i]}" "failed"
+            continue
+        fi
+
+        run=$( { time for ((r = 0; r < RUNS; ++r)); do "$executable" > /dev/null; done; } 2>&1 )
+        printf "%-20s %-16s %12s %12s %10s\n" "$name" "${PROFILES[$i]}" "$compile" "$run" \
+            "$(stat -c %s "$executable")"
+    done
+done
@@ -0,0 +1,111 @@
+#pragma once
+
+#include <cstdint>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+#include "ast/visitor.hpp"
+#include "bytecode/instruction_stream.hpp"
+#include "util/interner.hpp"
+
+namespace jackal::codegen::bytecode
+{
+/// @brief Describes a program that cannot be lowered to bytecode with the meaning it has in C.
+struct LoweringError
+{
+  explicit LoweringError(std::string message) noexcept : _message(std::move(message)) {}
+
+  [[nodiscard]] std::string_view message() const noexcept { return _message; }
+
+ private:
+  std::string _message;
+};
+
+/// @brief Lowers a Program into an instruction stream for the bytecode vm.
+///
+/// Each expression is evaluated into registers in source order, walked by ast::walk so that its
+/// depth is not limited by the native stack. Every intermediate value is read exactly once, so its
+/// live interval ends at the instruction that consumes it; registers are assigned by a linear scan
+/// over the emitted instructions, freeing the operands of each instruction before allocating its
+/// result and always reusing the lowest free register. The number of registers used is therefore
+/// the maximum number of values live at once.
+///
+/// Local slots are assigned by ast::Liveness when a whole Program is visited: values that are
+/// never live at the same time share a slot, and bindings that are never read are not lowered at
+/// all. Variables bound outside of a visited Program, or read without being bound, are assigned a
+/// slot of their own on first use.
+///
+/// The vm has no double arithmetic. The C backend adds doubles as doubles and converts the result
+/// to int once, when it is stored, so a double can only be lowered faithfully when it is the whole
+/// expression of a Binding; running ast::fold_constants first collapses constant chains into such
+/// a double. Any other double, or a double that does not fit in an int, is reported by error().
+struct BytecodeVisitor : public ast::Visitor
+{
+  // Phase 1 programs contain no V1 nodes
+  void visit(ast::Argument& /*node*/) noexcept override {}
+  void visit(ast::Arguments& /*node*/) noexcept override {}
+  void visit(ast::Context& /*node*/) noexcept override {}
+  void visit(ast::Data& /*node*/) noexcept override {}
+  void visit(ast::Executable& /*node*/) noexcept override {}
+  void visit(ast::Expressions& /*node*/) noexcept override {}
+  void visit(ast::Form& /*node*/) noexcept override {}
+  void visit(ast::Function& /*node*/) noexcept override {}
+  void visit(ast::FunctionCall& /*node*/) noexcept override {}
+  void visit(ast::Member& /*node*/) noexcept override {}
+  void visit(ast::Number& /*node*/) noexcept override {}
+  void visit(ast::Parameters& /*node*/) noexcept override {}
+  void visit(ast::Primitive& /*node*/) noexcept override {}
+  void visit(ast::PropertyAccess& /*node*/) noexcept override {}
+  void visit(ast::Scope& /*node*/) noexcept override {}
+  void visit(ast::Type& /*node*/) noexcept override {}
+  void visit(ast::Variable& /*node*/) noexcept override {}
+  void visit(ast::ValueV1& /*node*/) noexcept override {}
+
+  void visit(ast::Operator& node) noexcept override;
+
+  void visit(ast::Expression& node) noexcept override;
+  void visit(ast::Binding& node) noexcept override;
+  void visit(ast::Print& node) noexcept override;
+
+  void visit(ast::Instruction& node) noexcept override;
+  void visit(ast::Program& node) noexcept override;
+
+  void visit(ast::Value& node) noexcept override;
+  void visit(ast::Constant& node) noexcept override;
+  void visit(ast::LocalVariable& node) noexcept override;
+
+  /// @returns the instructions lowered so far
+  [[nodiscard]] jackal::bytecode::instruction_stream const& code() const noexcept { return _code; }
+
+  /// @returns the first construct that could not be lowered, in which case code() must not be run
+  [[nodiscard]] std::optional<LoweringError> const& error() const noexcept { return _error; }
+
+ private:
+  void push_constant(int64_t value) noexcept;
+  void fail(std::string message) noexcept;
+  uint64_t allocate() noexcept;
+  void release(uint64_t reg) noexcept;
+  uint64_t pop() noexcept;
+  uint64_t local(util::Symbol variable) noexcept;
+
+  jackal::bytecode::instruction_stream _code;
+
+  // Registers holding the values of the expressions visited but not yet consumed
+  std::vector<uint64_t> _values;
+  // Free registers below _registers, kept sorted in descending order
+  std::vector<uint64_t> _free;
+  uint64_t _registers = 0;
+
+  // Indexed by Symbol id; NoLocal marks variables that have not been assigned a slot
+  static constexpr uint64_t NoLocal = UINT64_MAX;
+  std::vector<uint64_t> _locals;
+  uint64_t _localCount = 0;
+  // The slot chosen by liveness analysis for the binding being lowered
+  std::optional<uint64_t> _bindingSlot;
+
+  std::optional<LoweringError> _error;
+};
+}  // namespace jackal::codegen::bytecode
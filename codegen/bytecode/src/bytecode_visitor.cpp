@@ -0,0 +1,209 @@
+#include "codegen/bytecode/bytecode_visitor.hpp"
+
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+#include <functional>
+#include <limits>
+#include <optional>
+#include <string>
+#include <utility>
+#include <variant>
+
+#include "ast/include.hpp"
+#include "ast/liveness.hpp"
+#include "ast/traversal.hpp"
+#include "ast/visitor.hpp"
+
+using jackal::codegen::bytecode::BytecodeVisitor;
+
+namespace
+{
+/// @returns the value of @p expression if it is a lone double constant
+auto lone_double(jackal::ast::Expression const& expression) noexcept -> std::optional<double>
+{
+  auto const* value = std::get_if<jackal::ast::Value>(&expression.expression());
+  auto const* constant =
+      value != nullptr ? std::get_if<jackal::ast::Constant>(&value->value()) : nullptr;
+  auto const* number = constant != nullptr ? std::get_if<double>(&constant->constant()) : nullptr;
+  return number != nullptr ? std::optional(*number) : std::nullopt;
+}
+}  // namespace
+
+auto BytecodeVisitor::visit(ast::Operator& node) noexcept -> void
+{
+  auto b = pop();
+  auto a = pop();
+  release(a);
+  release(b);
+  auto result = allocate();
+  switch (node.type())
+  {
+    case ast::Operator::Type::Add:
+      _code.emit_add(result, a, b);
+      break;
+  }
+  _values.push_back(result);
+}
+
+auto BytecodeVisitor::visit(ast::Expression& node) noexcept -> void
+{
+  ast::walk(node, *this, ast::WalkOrder::PostOrder);
+}
+
+auto BytecodeVisitor::visit(ast::Binding& node) noexcept -> void
+{
+  if (auto stored = lone_double(node.expression()))
+  {
+    // C converts the double to int once, as it is stored
+    auto truncated = std::trunc(*stored);
+    if (!(truncated >= std::numeric_limits<int>::min() &&
+          truncated <= std::numeric_limits<int>::max()))
+    {
+      fail("cannot store a double that does not fit in an int");
+      truncated = 0;
+    }
+    push_constant(static_cast<int64_t>(truncated));
+  }
+  else
+  {
+    node.expression().accept(*this);
+  }
+  auto value = pop();
+  release(value);
+
+  auto name = node.variable().name();
+  if (_bindingSlot.has_value())
+  {
+    if (name.id() >= _locals.size())
+    {
+      _locals.resize(name.id() + 1, NoLocal);
+    }
+    _locals[name.id()] = *std::exchange(_bindingSlot, std::nullopt);
+  }
+  _code.emit_store(local(name), value);
+}
+
+auto BytecodeVisitor::visit(ast::Print& node) noexcept -> void
+{
+  node.expression().accept(*this);
+  auto value = pop();
+  release(value);
+  _code.emit_print(value);
+}
+
+auto BytecodeVisitor::visit(ast::Instruction& node) noexcept -> void  // NOLINT
+{
+  std::visit(
+      [this](auto& variant)
+      {
+        variant.accept(*this);
+      },
+      node.instruction());
+}
+
+auto BytecodeVisitor::visit(ast::Program& node) noexcept -> void
+{
+  ast::Liveness liveness(node);
+  // Slots of variables read before they are bound are allocated above those of live values
+  _localCount = std::max<uint64_t>(_localCount, liveness.local_count());
+
+  auto& instructions = node.instructions();
+  for (std::size_t i = 0; i < instructions.size(); ++i)
+  {
+    if (std::holds_alternative<ast::Binding>(instructions[i].instruction()))
+    {
+      if (!liveness.live(i))
+      {
+        continue;
+      }
+      _bindingSlot = liveness.slot(i);
+    }
+    instructions[i].accept(*this);
+  }
+}
+
+auto BytecodeVisitor::visit(ast::Value& node) noexcept -> void
+{
+  std::visit(
+      [this](auto& variant)
+      {
+        variant.accept(*this);
+      },
+      node.value());
+}
+
+auto BytecodeVisitor::visit(ast::Constant& node) noexcept -> void
+{
+  if (auto const* integer = std::get_if<int64_t>(&node.constant()))
+  {
+    push_constant(*integer);
+    return;
+  }
+
+  // Lone doubles stored by a binding never reach here
+  fail("cannot lower double arithmetic, which the vm does not support");
+  push_constant(0);
+}
+
+auto BytecodeVisitor::visit(ast::LocalVariable& node) noexcept -> void
+{
+  auto reg = allocate();
+  _code.emit_load(reg, local(node.name()));
+  _values.push_back(reg);
+}
+
+auto BytecodeVisitor::push_constant(int64_t value) noexcept -> void
+{
+  auto reg = allocate();
+  _code.emit_constant(reg, value);
+  _values.push_back(reg);
+}
+
+auto BytecodeVisitor::fail(std::string message) noexcept -> void
+{
+  if (!_error.has_value())
+  {
+    _error.emplace(std::move(message));
+  }
+}
+
+auto BytecodeVisitor::allocate() noexcept -> uint64_t
+{
+  if (_free.empty())
+  {
+    return _registers++;
+  }
+
+  auto reg = _free.back();
+  _free.pop_back();
+  return reg;
+}
+
+auto BytecodeVisitor::release(uint64_t reg) noexcept -> void
+{
+  _free.insert(std::upper_bound(_free.begin(), _free.end(), reg, std::greater<>()), reg);
+}
+
+auto BytecodeVisitor::pop() noexcept -> uint64_t
+{
+  assert(!_values.empty());
+  auto reg = _values.back();
+  _values.pop_back();
+  return reg;
+}
+
+auto BytecodeVisitor::local(util::Symbol variable) noexcept -> uint64_t
+{
+  if (variable.id() >= _locals.size())
+  {
+    _locals.resize(variable.id() + 1, NoLocal);
+  }
+
+  auto& slot = _locals[variable.id()];
+  if (slot == NoLocal)
+  {
+    slot = _localCount++;
+  }
+  return slot;
+}
@@ -1,20 +1,35 @@
 #pragma once
 
+#include <optional>
 #include <string>
 #include <string_view>
 
+#include "ast/flat_tree.hpp"
 #include "ast/visitor.hpp"
 #include "codegen/c/file_builder.hpp"
 #include "codegen/code_generator.hpp"
+#include "util/interner.hpp"
 
 namespace jackal::codegen::c
 {
-struct CVisitor : public ast::Visitor, public CodeGenerator
+struct CVisitor : public ast::Visitor, public ast::FlatVisitor, public CodeGenerator
 {
-  explicit CVisitor(std::string name) noexcept;
+  /// @param name the name of the generated executable
+  /// @param interner the Interner that identifiers in the visited tree were interned into
+  CVisitor(std::string name, util::Interner const& interner) noexcept;
+
+  /// @brief Sets whether a program whose output is known at compile time is generated as a
+  /// single write of that output, rather than as the computations that produce it.
+  ///
+  /// Disabled by default, so that the generated code mirrors the program.
+  ///
+  /// @see ast::partially_evaluate
+  void set_precompute_output(bool enabled) noexcept { _precomputeOutput = enabled; }
 
   void visit(ast::Operator& node) noexcept override;
 
+  /// @brief Emits @p node by walking its tree with ast::walk, which reports the operands of each
+  /// Operator on its own.
   void visit(ast::Expression& node) noexcept override;
   void visit(ast::Binding& node) noexcept override;
   void visit(ast::Print& node) noexcept override;
@@ -26,10 +41,28 @@ struct CVisitor : public ast::Visitor, public CodeGenerator
   void visit(ast::Constant& node) noexcept override;
   void visit(ast::LocalVariable& node) noexcept override;
 
-  Executable generate() noexcept override;
+  void enter_binding(util::Symbol variable) noexcept override;
+  void leave_binding() noexcept override;
+
+  void enter_print() noexcept override;
+  void leave_print() noexcept override;
+
+  void visit_operator(ast::Operator::Type type) noexcept override;
+
+  void visit_integer(int64_t value) noexcept override;
+  void visit_double(double value) noexcept override;
+  void visit_local(util::Symbol name) noexcept override;
+
+  Executable generate(OptimizationProfile profile) noexcept override;
 
  private:
   std::string _name;
+  util::Interner const& _interner;
   FileBuilder _fileBuilder;
+  bool _precomputeOutput = false;
+
+  // Open statements of the instruction currently being walked by a FlatTree
+  std::optional<VariableBinding> _binding;
+  std::optional<FunctionCall> _call;
 };
 }  // namespace jackal::codegen::c
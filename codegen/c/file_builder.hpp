@@ -1,14 +1,15 @@
 #pragma once
 
 #include <cstddef>
+#include <cstdint>
 #include <map>
 #include <optional>
-#include <ostream>
 #include <sstream>
 #include <string>
 #include <vector>
 
 #include "codegen/c/dependency.hpp"
+#include "codegen/output_buffer.hpp"
 #include "util/result.hpp"
 
 namespace jackal::codegen::c
@@ -39,14 +40,22 @@ struct FileBuilder
 {
   [[nodiscard]] std::optional<DivergentDependencyError> add_dependency(Dependency dep) noexcept;
 
-  std::ostream& operator<<(std::string_view code) noexcept;
-  std::ostream& operator<<(char code) noexcept;
+  /// @brief Ensures that the next @p bytes bytes of code can be written without allocating.
+  void reserve(std::size_t bytes) noexcept { _file.reserve(bytes); }
 
-  std::string build() noexcept;
+  FileBuilder& operator<<(std::string_view code) noexcept;
+  FileBuilder& operator<<(char code) noexcept;
+  FileBuilder& operator<<(int64_t code) noexcept;
+  FileBuilder& operator<<(double code) noexcept;
+
+  /// @brief Wraps the code written so far in the includes and entry point of a C file.
+  ///
+  /// The written code is moved into the result rather than copied, leaving the FileBuilder empty.
+  OutputBuffer build() noexcept;
 
  private:
   std::map<std::string_view, Dependency> _dependencies;
-  std::ostringstream _file;
+  OutputBuffer _file;
 };
 
 struct Parameter
@@ -73,13 +82,13 @@ struct FunctionDefinition
       }
       _fileBuilder << params.back().type << ' ' << params.back().name;
     }
-    _fileBuilder << ") {" << std::endl;
+    _fileBuilder << ") {\n";
   }
 
   FunctionDefinition(FileBuilder& fileBuilder, std::string_view returnType, std::string_view name,
                      std::vector<Parameter> const& params) noexcept;
 
-  ~FunctionDefinition() noexcept { _fileBuilder << '}' << std::endl; }
+  ~FunctionDefinition() noexcept { _fileBuilder << "}\n"; }
 
   FunctionDefinition(FunctionDefinition const&) = delete;
   FunctionDefinition& operator=(FunctionDefinition const&) = delete;
@@ -131,4 +140,22 @@ struct DirectExpression
  private:
   FileBuilder& _fileBuilder;
 };
+
+/// @brief Writes text as a C string literal.
+///
+/// Each line of the text is written as its own literal on its own line of code; the C compiler
+/// concatenates adjacent literals back into one string.
+struct StringLiteral
+{
+  StringLiteral(FileBuilder& fileBuilder, std::string_view text) noexcept;
+  ~StringLiteral() noexcept = default;
+
+  StringLiteral(StringLiteral const&) = delete;
+  StringLiteral& operator=(StringLiteral const&) = delete;
+  StringLiteral(StringLiteral&&) noexcept = delete;
+  StringLiteral& operator=(StringLiteral&&) noexcept = delete;
+
+ private:
+  FileBuilder& _fileBuilder;
+};
 }  // namespace jackal::codegen::c
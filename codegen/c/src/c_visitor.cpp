@@ -1,54 +1,49 @@
 #include "codegen/c/c_visitor.hpp"
 
 #include <array>
+#include <cstddef>
 #include <string>
 #include <variant>
 
 #include "ast/include.hpp"
+#include "ast/partial_evaluation.hpp"
+#include "ast/traversal.hpp"
 #include "ast/visitor.hpp"
 #include "codegen/c/file_builder.hpp"
 #include "codegen/executable.hpp"
 
 using jackal::codegen::c::CVisitor;
 
-CVisitor::CVisitor(std::string name) noexcept : _name(std::move(name)) {}
+namespace
+{
+// A rough upper bound on the C emitted for one instruction, used to size the output up front
+constexpr std::size_t BytesPerInstruction = 32;
+}  // namespace
 
-auto CVisitor::visit(ast::Operator& node) noexcept -> void
+CVisitor::CVisitor(std::string name, util::Interner const& interner) noexcept
+    : _name(std::move(name)), _interner(interner)
 {
-  node.a().accept(*this);
-  switch (node.type())
-  {
-    case jackal::ast::Operator::Type::Add:
-      DirectExpression(_fileBuilder, " + ");
-      break;
-  }
-  node.b().accept(*this);
 }
 
+auto CVisitor::visit(ast::Operator& node) noexcept -> void { visit_operator(node.type()); }
+
 auto CVisitor::visit(ast::Expression& node) noexcept -> void
 {
-  std::visit(
-      [this](auto& variant)
-      {
-        variant.accept(*this);
-      },
-      node.expression());
+  ast::walk(node, *this, ast::WalkOrder::InOrder);
 }
 
 auto CVisitor::visit(ast::Binding& node) noexcept -> void
 {
-  auto binding = VariableBinding(_fileBuilder, "int", node.variable().name());
+  enter_binding(node.variable().name());
   node.expression().accept(*this);
+  leave_binding();
 }
 
 auto CVisitor::visit(ast::Print& node) noexcept -> void
 {
-  auto result = _fileBuilder.add_dependency({Dependency::Type::System, "stdio.h"});
-  // TODO: handle this result properly, forward through type system
-  assert(!result.has_value());
-  auto call = FunctionCall(_fileBuilder, "printf");
-  DirectExpression(_fileBuilder, "\"%d\\n\", ");  // NOLINT
+  enter_print();
   node.expression().accept(*this);
+  leave_print();
 }
 
 auto CVisitor::visit(ast::Instruction& node) noexcept -> void  // NOLINT
@@ -63,6 +58,23 @@ auto CVisitor::visit(ast::Instruction& node) noexcept -> void  // NOLINT
 
 auto CVisitor::visit(ast::Program& node) noexcept -> void
 {
+  if (_precomputeOutput)
+  {
+    if (auto output = ast::partially_evaluate(node).output; output.has_value())
+    {
+      if (!output->empty())
+      {
+        auto result = _fileBuilder.add_dependency({Dependency::Type::System, "stdio.h"});
+        assert(!result.has_value());
+        FunctionCall call(_fileBuilder, "fputs");
+        StringLiteral(_fileBuilder, *output);
+        DirectExpression(_fileBuilder, ", stdout");
+      }
+      return;
+    }
+  }
+
+  _fileBuilder.reserve(node.instructions().size() * BytesPerInstruction);
   for (auto& instr : node.instructions())
   {
     instr.accept(*this);
@@ -81,19 +93,54 @@ auto CVisitor::visit(ast::Value& node) noexcept -> void
 
 auto CVisitor::visit(ast::Constant& node) noexcept -> void
 {
-  auto str = std::visit(
-      [](auto cnst)
+  std::visit(
+      [this](auto cnst)
       {
-        return std::to_string(cnst);
+        _fileBuilder << cnst;
       },
       node.constant());
+}
+
+auto CVisitor::visit(ast::LocalVariable& node) noexcept -> void { visit_local(node.name()); }
 
-  DirectExpression(_fileBuilder, str);
+auto CVisitor::enter_binding(util::Symbol variable) noexcept -> void
+{
+  _binding.emplace(_fileBuilder, "int", _interner.name(variable));
+}
+
+auto CVisitor::leave_binding() noexcept -> void { _binding.reset(); }
+
+auto CVisitor::enter_print() noexcept -> void
+{
+  auto result = _fileBuilder.add_dependency({Dependency::Type::System, "stdio.h"});
+  // TODO: handle this result properly, forward through type system
+  assert(!result.has_value());
+  _call.emplace(_fileBuilder, "printf");
+  DirectExpression(_fileBuilder, "\"%d\\n\", ");  // NOLINT
+}
+
+auto CVisitor::leave_print() noexcept -> void { _call.reset(); }
+
+auto CVisitor::visit_operator(ast::Operator::Type type) noexcept -> void
+{
+  switch (type)
+  {
+    case jackal::ast::Operator::Type::Add:
+      DirectExpression(_fileBuilder, " + ");
+      break;
+  }
 }
 
-auto CVisitor::visit(ast::LocalVariable& node) noexcept -> void
+auto CVisitor::visit_integer(int64_t value) noexcept -> void { _fileBuilder << value; }
+
+auto CVisitor::visit_double(double value) noexcept -> void { _fileBuilder << value; }
+
+auto CVisitor::visit_local(util::Symbol name) noexcept -> void
 {
-  DirectExpression(_fileBuilder, node.name());
+  DirectExpression(_fileBuilder, _interner.name(name));
 }
 
-auto CVisitor::generate() noexcept -> Executable { return {_name, _fileBuilder.build()}; }
+auto CVisitor::generate(OptimizationProfile profile) noexcept -> Executable
+{
+  return {_name, _fileBuilder.build(), CCompiler::make(profile)};
+}
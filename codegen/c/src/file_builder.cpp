@@ -1,7 +1,7 @@
 #include "codegen/c/file_builder.hpp"
 
-#include <sstream>
 #include <string>
+#include <utility>
 
 #include "codegen/c/dependency.hpp"
 
@@ -9,6 +9,7 @@ using jackal::codegen::c::DirectExpression;
 using jackal::codegen::c::FileBuilder;
 using jackal::codegen::c::FunctionCall;
 using jackal::codegen::c::FunctionDefinition;
+using jackal::codegen::c::StringLiteral;
 using jackal::codegen::c::VariableBinding;
 
 auto FileBuilder::add_dependency(Dependency dep) noexcept -> std::optional<DivergentDependencyError>
@@ -23,36 +24,57 @@ auto FileBuilder::add_dependency(Dependency dep) noexcept -> std::optional<Diver
   return std::nullopt;
 }
 
-auto FileBuilder::build() noexcept -> std::string
+auto FileBuilder::build() noexcept -> OutputBuffer
 {
-  std::ostringstream oss;
+  OutputBuffer output;
   for (auto const& [include, dep] : _dependencies)
   {
     switch (dep.type())
     {
       case Dependency::Type::System:
-        oss << "#include <" << include << '>' << std::endl;
+        output.append("#include <");
+        output.append(include);
+        output.append(">\n");
         break;
       case Dependency::Type::Source:
-        oss << "#include \"" << include << '"' << std::endl;
+        output.append("#include \"");
+        output.append(include);
+        output.append("\"\n");
         break;
     }
   }
-  oss << std::endl;
+  output.append('\n');
 
-  oss << "int main(int argc, char** argv) {" << std::endl;
-  oss << _file.str();
-  oss << '}' << std::endl;
+  output.append("int main(int argc, char** argv) {\n");
+  output.splice(std::move(_file));
+  output.append("}\n");
 
-  return oss.str();
+  return output;
 }
 
-auto FileBuilder::operator<<(std::string_view code) noexcept -> std::ostream&
+auto FileBuilder::operator<<(std::string_view code) noexcept -> FileBuilder&
 {
-  return _file << code;
+  _file.append(code);
+  return *this;
 }
 
-auto FileBuilder::operator<<(char code) noexcept -> std::ostream& { return _file << code; }
+auto FileBuilder::operator<<(char code) noexcept -> FileBuilder&
+{
+  _file.append(code);
+  return *this;
+}
+
+auto FileBuilder::operator<<(int64_t code) noexcept -> FileBuilder&
+{
+  _file.append(code);
+  return *this;
+}
+
+auto FileBuilder::operator<<(double code) noexcept -> FileBuilder&
+{
+  _file.append(code);
+  return *this;
+}
 
 FunctionDefinition::FunctionDefinition(FileBuilder& fileBuilder, std::string_view returnType,
                                        std::string_view name,
@@ -69,7 +91,7 @@ FunctionDefinition::FunctionDefinition(FileBuilder& fileBuilder, std::string_vie
     }
     _fileBuilder << params.back().type << ' ' << params.back().name;
   }
-  _fileBuilder << ") {" << std::endl;
+  _fileBuilder << ") {\n";
 }
 
 FunctionCall::FunctionCall(FileBuilder& fileBuilder, std::string_view name) noexcept
@@ -78,7 +100,7 @@ FunctionCall::FunctionCall(FileBuilder& fileBuilder, std::string_view name) noex
   _fileBuilder << name << '(';
 }
 
-FunctionCall::~FunctionCall() noexcept { _fileBuilder << ");" << std::endl; }
+FunctionCall::~FunctionCall() noexcept { _fileBuilder << ");\n"; }
 
 VariableBinding::VariableBinding(FileBuilder& fileBuilder, std::string_view type,
                                  std::string_view name) noexcept
@@ -87,10 +109,48 @@ VariableBinding::VariableBinding(FileBuilder& fileBuilder, std::string_view type
   _fileBuilder << type << ' ' << name << " = ";
 }
 
-VariableBinding::~VariableBinding() noexcept { _fileBuilder << ';' << std::endl; }
+VariableBinding::~VariableBinding() noexcept { _fileBuilder << ";\n"; }
 
 DirectExpression::DirectExpression(FileBuilder& fileBuilder, std::string_view expression) noexcept
     : _fileBuilder(fileBuilder)
 {
   _fileBuilder << expression;
 }
+
+StringLiteral::StringLiteral(FileBuilder& fileBuilder, std::string_view text) noexcept
+    : _fileBuilder(fileBuilder)
+{
+  _fileBuilder << '"';
+  for (std::size_t i = 0; i < text.size(); ++i)
+  {
+    auto c = static_cast<unsigned char>(text[i]);
+    switch (c)
+    {
+      case '\n':
+        _fileBuilder << "\\n";
+        if (i + 1 < text.size())
+        {
+          _fileBuilder << "\"\n\"";
+        }
+        break;
+      case '"':
+      case '\\':
+        _fileBuilder << '\\' << static_cast<char>(c);
+        break;
+      default:
+        if (c < ' ' || c >= 0x7f)
+        {
+          // Octal escapes end after three digits, so they cannot run into the text that follows
+          _fileBuilder << '\\' << static_cast<char>('0' + (c >> 6))
+                       << static_cast<char>('0' + ((c >> 3) & 7))
+                       << static_cast<char>('0' + (c & 7));
+        }
+        else
+        {
+          _fileBuilder << static_cast<char>(c);
+        }
+        break;
+    }
+  }
+  _fileBuilder << '"';
+}
@@ -0,0 +1,70 @@
+#pragma once
+
+#include <filesystem>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "codegen/optimization_profile.hpp"
+#include "codegen/output_buffer.hpp"
+
+namespace jackal::codegen
+{
+/// @brief A backend that turns generated C source into a runnable program.
+///
+/// Executables compile through whichever CCompiler they are given, so the C toolchain can be
+/// swapped without changing code generation.
+struct CCompiler
+{
+  virtual ~CCompiler() = default;
+
+  /// @returns the compiler for OptimizationProfile::Debug
+  [[nodiscard]] static std::shared_ptr<CCompiler const> make_default() noexcept
+  {
+    return make(OptimizationProfile::Debug);
+  }
+
+  /// @returns the external clang compiler with the flags of @p profile
+  [[nodiscard]] static std::shared_ptr<CCompiler const> make(OptimizationProfile profile) noexcept;
+
+  /// @returns a description of the compiler and its configuration; compilers with the same
+  /// identity produce equivalent executables from the same source
+  [[nodiscard]] virtual std::string identity() const noexcept = 0;
+
+  /// @brief Compiles @p source to an executable file at @p executable.
+  ///
+  /// Any intermediate files are written next to @p executable.
+  ///
+  /// @returns whether compilation succeeded
+  [[nodiscard]] virtual bool compile(OutputBuffer const& source,
+                                     std::filesystem::path const& executable) const noexcept = 0;
+};
+
+/// @brief Compiles by writing the source to disk and invoking an external compiler process.
+///
+/// Each compilation pays for process creation and compiler startup, but can use every
+/// optimization the external compiler offers.
+struct ExternalCCompiler final : CCompiler
+{
+  static constexpr auto DefaultCommand = "/usr/local/bin/clang";
+
+  explicit ExternalCCompiler(std::string command = DefaultCommand,
+                             std::vector<std::string> flags = {}) noexcept
+      : _command(std::move(command)), _flags(std::move(flags))
+  {
+  }
+
+  [[nodiscard]] std::string const& command() const noexcept { return _command; }
+
+  [[nodiscard]] std::vector<std::string> const& flags() const noexcept { return _flags; }
+
+  [[nodiscard]] std::string identity() const noexcept override;
+
+  [[nodiscard]] bool compile(OutputBuffer const& source,
+                             std::filesystem::path const& executable) const noexcept override;
+
+ private:
+  std::string _command;
+  std::vector<std::string> _flags;
+};
+}  // namespace jackal::codegen
@@ -2,6 +2,8 @@
 
 #include <string>
 
+#include "codegen/optimization_profile.hpp"
+
 // clang-format off
 namespace jackal::codegen { struct Executable; }
 // clang-format on
@@ -25,9 +27,11 @@ struct CodeGenerator
   /// @brief Compile and persist an Executable to disk.
   ///
   /// Because CodeGenerator implementations are meant for use alongside Visitor implementations,
-  /// this function accepts no parameters. The visitor responsible for generating the code is
-  /// expected to incrementally construct its own state internally which can then be used during
-  /// final code generation.
-  virtual Executable generate() noexcept = 0;
+  /// this function accepts nothing about the program itself. The visitor responsible for
+  /// generating the code is expected to incrementally construct its own state internally which
+  /// can then be used during final code generation.
+  ///
+  /// @param profile how much effort to spend optimizing the executable when it is compiled
+  virtual Executable generate(OptimizationProfile profile) noexcept = 0;
 };
 }  // namespace jackal::codegen
@@ -0,0 +1,77 @@
+#pragma once
+
+#include <cstdint>
+#include <filesystem>
+#include <memory>
+#include <optional>
+#include <string>
+#include <string_view>
+
+#include "codegen/c_compiler.hpp"
+#include "codegen/output_buffer.hpp"
+
+namespace jackal::codegen
+{
+/// @brief An on-disk store of compiled executables, addressed by what they were compiled from.
+///
+/// Each entry is a single file named by its key. Entries are written under a temporary name and
+/// renamed into place, so concurrent compilers sharing a cache directory never observe a partial
+/// executable. An entry's modification time records when it was last stored or fetched, and the
+/// least recently used entries are evicted whenever a store takes the cache over its size limit.
+struct CompileCache
+{
+  static constexpr std::uintmax_t DefaultMaxBytes = 256ULL * 1024 * 1024;
+
+  /// @brief Uses @p directory as the cache, creating it if it does not exist.
+  explicit CompileCache(std::filesystem::path directory,
+                        std::uintmax_t maxBytes = DefaultMaxBytes) noexcept;
+
+  /// @returns the key of the executable compiled from @p source by a compiler with identity
+  /// @p compiler: the SHA-256 digest of both, so that different programs never share an entry
+  [[nodiscard]] static std::string key(OutputBuffer const& source,
+                                       std::string_view compiler) noexcept;
+
+  /// @brief Hard links the entry for @p key to @p destination, or copies it where links are not
+  /// supported, and marks it as recently used.
+  ///
+  /// A linked destination shares its storage with the cache, so it must be replaced rather than
+  /// modified in place.
+  ///
+  /// @returns whether the cache held an entry for @p key
+  [[nodiscard]] bool fetch(std::string const& key,
+                           std::filesystem::path const& destination) const noexcept;
+
+  /// @brief Adds @p executable to the cache under @p key, then evicts entries until the cache is
+  /// within its size limit.
+  ///
+  /// Failures to write to the cache are ignored; the cache only ever saves work.
+  void store(std::string const& key, std::filesystem::path const& executable) const noexcept;
+
+  [[nodiscard]] std::filesystem::path const& directory() const noexcept { return _directory; }
+
+ private:
+  void evict() const noexcept;
+
+  std::filesystem::path _directory;
+  std::uintmax_t _maxBytes;
+};
+
+/// @brief A compiler that reuses executables from a CompileCache, and otherwise compiles with
+/// another compiler and stores the result.
+struct CachingCCompiler final : CCompiler
+{
+  CachingCCompiler(std::shared_ptr<CCompiler const> compiler, CompileCache cache) noexcept
+      : _compiler(std::move(compiler)), _cache(std::move(cache))
+  {
+  }
+
+  [[nodiscard]] std::string identity() const noexcept override { return _compiler->identity(); }
+
+  [[nodiscard]] bool compile(OutputBuffer const& source,
+                             std::filesystem::path const& executable) const noexcept override;
+
+ private:
+  std::shared_ptr<CCompiler const> _compiler;
+  CompileCache _cache;
+};
+}  // namespace jackal::codegen
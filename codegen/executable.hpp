@@ -1,10 +1,13 @@
 #pragma once
 
 #include <filesystem>
+#include <memory>
 #include <optional>
 #include <string>
 #include <string_view>
 
+#include "codegen/c_compiler.hpp"
+#include "codegen/output_buffer.hpp"
 #include "util/file_system.hpp"
 
 namespace jackal::codegen
@@ -16,9 +19,27 @@ namespace jackal::codegen
 struct Executable
 {
   /// @brief Creates an Executable that will use a randomly generated temporary directory.
-  Executable(std::string name, std::string source) noexcept;
+  ///
+  /// The generated source is taken over as-is and handed to the compiler chunk by chunk.
+  Executable(std::string name, OutputBuffer source,
+             std::shared_ptr<CCompiler const> compiler = CCompiler::make_default()) noexcept;
   /// @brief Creates an Executable that will use the provided temporary directory.
-  Executable(std::string name, std::string source, util::TemporaryDirectory&& directory) noexcept;
+  Executable(std::string name, OutputBuffer source, util::TemporaryDirectory&& directory,
+             std::shared_ptr<CCompiler const> compiler = CCompiler::make_default()) noexcept;
+
+  /// @brief Replaces the compiler used by compile() and execute().
+  ///
+  /// Has no effect on an executable that has already been compiled.
+  void set_compiler(std::shared_ptr<CCompiler const> compiler) noexcept
+  {
+    _compiler = std::move(compiler);
+  }
+
+  /// @returns the compiler used by compile() and execute()
+  [[nodiscard]] std::shared_ptr<CCompiler const> const& compiler() const noexcept
+  {
+    return _compiler;
+  }
 
   /// @brief Attempts to compile the provided intermediate source code to an on-disk executable.
   ///
@@ -30,9 +51,10 @@ struct Executable
   /// @returns the path to the executable file if compilation succeeds
   [[nodiscard]] std::optional<std::string_view> compile() noexcept;
 
-  /// @brief Attempts to execute the Executable in an external shell.
+  /// @brief Attempts to execute the Executable and capture its output.
   ///
-  /// This function will attempt to compile the executable if it has not already been compiled.
+  /// This function will attempt to compile the executable if it has not already been compiled and
+  /// run it in an external shell.
   ///
   /// @see jackal::util::exec
   [[nodiscard]] std::optional<std::string> execute() noexcept;
@@ -40,13 +62,14 @@ struct Executable
   /// @returns the name of the executable as defined by the Jackal specification
   [[nodiscard]] std::string name() const noexcept { return _name; }
 
-  /// @returns the generated intermediate source code of the executable
-  [[nodiscard]] std::string source() const noexcept { return _source; }
+  /// @returns a contiguous copy of the generated intermediate source code of the executable
+  [[nodiscard]] std::string source() const noexcept { return _source.str(); }
 
  private:
   std::string _name;
-  std::string _source;
+  OutputBuffer _source;
   util::TemporaryDirectory _dir;
+  std::shared_ptr<CCompiler const> _compiler;
   std::optional<std::string> _path;
 };
 }  // namespace jackal::codegen
@@ -0,0 +1,30 @@
+#pragma once
+
+#include <optional>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace jackal::codegen
+{
+/// @brief How much effort the C compiler spends optimizing an executable.
+enum class OptimizationProfile
+{
+  /// Compiles as fast as possible: clang with -O0 -g
+  Debug,
+  /// Optimizes for any machine of the target architecture
+  Release,
+  /// Optimizes for the machine doing the compiling; executables may not run anywhere else
+  ReleaseNative
+};
+
+/// @returns the profile named @p name on the command line, or std::nullopt if there is none
+[[nodiscard]] std::optional<OptimizationProfile> parse_optimization_profile(
+    std::string_view name) noexcept;
+
+/// @returns the command line name of @p profile
+[[nodiscard]] std::string_view name(OptimizationProfile profile) noexcept;
+
+/// @returns the flags passed to an external C compiler when compiling with @p profile
+[[nodiscard]] std::vector<std::string> c_flags(OptimizationProfile profile) noexcept;
+}  // namespace jackal::codegen
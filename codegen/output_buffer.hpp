@@ -0,0 +1,92 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <ostream>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace jackal::codegen
+{
+/// @brief An append-only byte buffer for generated source code.
+///
+/// Bytes are written into a list of heap chunks that are never reallocated, so appending never
+/// moves previously written output. Buffers can be spliced onto one another by transferring their
+/// chunks, which lets a generator assemble a file from independently written sections without
+/// copying them.
+struct OutputBuffer
+{
+  static constexpr std::size_t DefaultChunkSize = 64 * 1024;
+
+  OutputBuffer() noexcept = default;
+
+  /// @param sizeHint the number of bytes expected to be written, used to size the first chunk
+  explicit OutputBuffer(std::size_t sizeHint) noexcept { reserve(sizeHint); }
+
+  /// @brief Ensures that the next @p bytes bytes can be appended without allocating.
+  void reserve(std::size_t bytes) noexcept;
+
+  void append(std::string_view bytes) noexcept;
+  void append(char byte) noexcept;
+
+  /// @brief Appends the decimal representation of @p value.
+  void append(int64_t value) noexcept;
+
+  /// @brief Appends the shortest C double literal that reads back as exactly @p value, or a
+  /// constant expression that evaluates to it when @p value is infinite or NaN.
+  void append(double value) noexcept;
+
+  /// @brief Moves every chunk of @p other onto the end of this buffer without copying its bytes.
+  void splice(OutputBuffer&& other) noexcept;
+
+  /// @returns the total number of bytes written
+  [[nodiscard]] std::size_t size() const noexcept { return _size; }
+
+  [[nodiscard]] bool empty() const noexcept { return _size == 0; }
+
+  /// @returns views of the written bytes in order; valid until the buffer is next modified
+  [[nodiscard]] std::vector<std::string_view> chunks() const noexcept;
+
+  /// @brief Writes every chunk to @p output without concatenating them first.
+  void write_to(std::ostream& output) const noexcept;
+
+  /// @returns a contiguous copy of the written bytes
+  [[nodiscard]] std::string str() const noexcept;
+
+ private:
+  struct Chunk
+  {
+    std::unique_ptr<char[]> data;  // NOLINT
+    std::size_t size;
+    std::size_t capacity;
+  };
+
+  /// @returns a pointer to @p bytes bytes of free space at the end of the last chunk
+  char* claim(std::size_t bytes) noexcept
+  {
+    if (_chunks.empty() || _chunks.back().capacity - _chunks.back().size < bytes) [[unlikely]]
+    {
+      reserve(bytes);
+    }
+
+    auto& chunk = _chunks.back();
+    auto* free = chunk.data.get() + chunk.size;
+    chunk.size += bytes;
+    _size += bytes;
+    return free;
+  }
+
+  /// @brief Returns the unused tail of a claim made with more room than was needed.
+  void release(std::size_t bytes) noexcept
+  {
+    _chunks.back().size -= bytes;
+    _size -= bytes;
+  }
+
+ private:
+  std::vector<Chunk> _chunks;
+  std::size_t _size = 0;
+};
+}  // namespace jackal::codegen
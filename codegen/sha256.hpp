@@ -0,0 +1,41 @@
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <string_view>
+
+namespace jackal::codegen
+{
+/// @brief Computes a SHA-256 digest of bytes supplied in any number of pieces.
+///
+/// Used wherever content must be addressed by a digest that two different inputs will not share
+/// in practice, such as the keys of a compile cache shared between machines.
+struct Sha256
+{
+  static constexpr std::size_t DigestSize = 32;
+
+  using Digest = std::array<uint8_t, DigestSize>;
+
+  /// @brief Appends @p bytes to the message being digested.
+  void update(std::string_view bytes) noexcept;
+
+  /// @returns the digest of every byte appended so far; the object must not be updated afterwards
+  [[nodiscard]] Digest finish() noexcept;
+
+  /// @returns @p digest as lowercase hexadecimal
+  [[nodiscard]] static std::string hex(Digest const& digest) noexcept;
+
+ private:
+  static constexpr std::size_t BlockSize = 64;
+
+  void compress(uint8_t const* block) noexcept;
+
+  std::array<uint32_t, 8> _state{0x6a09e667, 0xbb67ae85, 0x3c6ef372, 0xa54ff53a,
+                                 0x510e527f, 0x9b05688c, 0x1f83d9ab, 0x5be0cd19};
+  std::array<uint8_t, BlockSize> _block{};
+  std::size_t _blockSize = 0;
+  uint64_t _length = 0;
+};
+}  // namespace jackal::codegen
@@ -0,0 +1,39 @@
+#include "codegen/c_compiler.hpp"
+
+#include <fstream>
+
+#include "util/exec.hpp"
+
+using jackal::codegen::CCompiler;
+using jackal::codegen::ExternalCCompiler;
+using jackal::codegen::OptimizationProfile;
+
+auto CCompiler::make(OptimizationProfile profile) noexcept -> std::shared_ptr<CCompiler const>
+{
+  return std::make_shared<ExternalCCompiler>(ExternalCCompiler::DefaultCommand, c_flags(profile));
+}
+
+auto ExternalCCompiler::identity() const noexcept -> std::string
+{
+  auto identity = _command;
+  for (auto const& flag : _flags)
+  {
+    identity += " " + flag;
+  }
+  return identity;
+}
+
+auto ExternalCCompiler::compile(OutputBuffer const& source,
+                                std::filesystem::path const& executable) const noexcept -> bool
+{
+  auto srcPath = std::filesystem::path(executable).replace_extension(".c");
+
+  std::ofstream output;
+  output.open(srcPath);
+  source.write_to(output);
+  output.close();
+
+  // TODO: handle linking when required
+  return util::exec(identity() + " " + srcPath.string() + " -o " + executable.string())
+      .has_value();
+}
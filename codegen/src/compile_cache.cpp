@@ -0,0 +1,173 @@
+#include "codegen/compile_cache.hpp"
+
+#include <unistd.h>
+
+#include <algorithm>
+#include <system_error>
+#include <vector>
+
+#include "codegen/sha256.hpp"
+
+using jackal::codegen::CachingCCompiler;
+using jackal::codegen::CompileCache;
+using jackal::codegen::Sha256;
+
+namespace fs = std::filesystem;
+
+namespace
+{
+/// Links @p from to @p to, or copies it if the file system does not support hard links
+auto link_or_copy(fs::path const& from, fs::path const& to) noexcept -> bool
+{
+  std::error_code error;
+  fs::create_hard_link(from, to, error);
+  if (error)
+  {
+    error.clear();
+    fs::copy_file(from, to, fs::copy_options::overwrite_existing, error);
+  }
+  return !error;
+}
+
+/// Entries are named by their key alone; anything else is a store in progress
+auto is_entry(fs::directory_entry const& entry) noexcept -> bool
+{
+  std::error_code error;
+  return entry.is_regular_file(error) && !entry.path().has_extension();
+}
+}  // namespace
+
+CompileCache::CompileCache(fs::path directory, std::uintmax_t maxBytes) noexcept
+    : _directory(std::move(directory)), _maxBytes(maxBytes)
+{
+  std::error_code error;
+  fs::create_directories(_directory, error);
+}
+
+auto CompileCache::key(OutputBuffer const& source, std::string_view compiler) noexcept
+    -> std::string
+{
+  // The compiler identity is terminated so that it cannot run into the source
+  Sha256 digest;
+  digest.update(compiler);
+  digest.update(std::string_view("\0", 1));
+  for (auto chunk : source.chunks())
+  {
+    digest.update(chunk);
+  }
+  return Sha256::hex(digest.finish());
+}
+
+auto CompileCache::fetch(std::string const& key, fs::path const& destination) const noexcept
+    -> bool
+{
+  auto entry = _directory / key;
+  std::error_code error;
+  if (!fs::is_regular_file(entry, error))
+  {
+    return false;
+  }
+
+  fs::remove(destination, error);
+  if (!link_or_copy(entry, destination))
+  {
+    return false;
+  }
+
+  fs::last_write_time(entry, fs::file_time_type::clock::now(), error);
+  return true;
+}
+
+auto CompileCache::store(std::string const& key, fs::path const& executable) const noexcept
+    -> void
+{
+  // Copied rather than linked, so that nothing outside the cache can modify the entry in place
+  auto temporary = _directory / (key + ".tmp" + std::to_string(::getpid()));
+  std::error_code error;
+  fs::copy_file(executable, temporary, fs::copy_options::overwrite_existing, error);
+  if (error)
+  {
+    return;
+  }
+
+  fs::rename(temporary, _directory / key, error);
+  if (error)
+  {
+    fs::remove(temporary, error);
+    return;
+  }
+
+  fs::last_write_time(_directory / key, fs::file_time_type::clock::now(), error);
+  evict();
+}
+
+auto CompileCache::evict() const noexcept -> void
+{
+  struct Entry
+  {
+    fs::path path;
+    std::uintmax_t size;
+    fs::file_time_type used;
+  };
+
+  std::error_code error;
+  std::vector<Entry> entries;
+  std::uintmax_t total = 0;
+  for (fs::directory_iterator it(_directory, error), end; !error && it != end; it.increment(error))
+  {
+    if (!is_entry(*it))
+    {
+      continue;
+    }
+
+    std::error_code statError;
+    auto size = it->file_size(statError);
+    auto used = it->last_write_time(statError);
+    if (!statError)
+    {
+      entries.push_back({it->path(), size, used});
+      total += size;
+    }
+  }
+
+  if (total <= _maxBytes)
+  {
+    return;
+  }
+
+  std::sort(entries.begin(), entries.end(),
+            [](auto const& a, auto const& b) { return a.used < b.used; });
+  for (auto const& entry : entries)
+  {
+    if (total <= _maxBytes)
+    {
+      break;
+    }
+
+    if (fs::remove(entry.path, error))
+    {
+      total -= entry.size;
+    }
+  }
+}
+
+auto CachingCCompiler::compile(OutputBuffer const& source,
+                               fs::path const& executable) const noexcept -> bool
+{
+  auto key = CompileCache::key(source, _compiler->identity());
+  if (_cache.fetch(key, executable))
+  {
+    return true;
+  }
+
+  // The destination may be a link to a cache entry from an earlier fetch; never write through it
+  std::error_code error;
+  fs::remove(executable, error);
+  if (!_compiler->compile(source, executable))
+  {
+    return false;
+  }
+
+  _cache.store(key, executable);
+  return true;
+}
@@ -1,21 +1,23 @@
 #include "codegen/executable.hpp"
 
-#include <fstream>
-#include <iostream>
-
 #include "util/exec.hpp"
 #include "util/file_system.hpp"
 
 using jackal::codegen::Executable;
 
-Executable::Executable(std::string name, std::string source) noexcept
-    : Executable(std::move(name), std::move(source), util::TemporaryDirectory())
+Executable::Executable(std::string name, OutputBuffer source,
+                       std::shared_ptr<CCompiler const> compiler) noexcept
+    : Executable(std::move(name), std::move(source), util::TemporaryDirectory(),
+                 std::move(compiler))
 {
 }
 
-Executable::Executable(std::string name, std::string source,
-                       util::TemporaryDirectory&& directory) noexcept
-    : _name(std::move(name)), _source(std::move(source)), _dir(std::move(directory))
+Executable::Executable(std::string name, OutputBuffer source, util::TemporaryDirectory&& directory,
+                       std::shared_ptr<CCompiler const> compiler) noexcept
+    : _name(std::move(name)),
+      _source(std::move(source)),
+      _dir(std::move(directory)),
+      _compiler(std::move(compiler))
 {
 }
 
@@ -26,17 +28,8 @@ auto Executable::compile() noexcept -> std::optional<std::string_view>
     return _path;
   }
 
-  auto srcPath = _dir.directory() / (_name + ".c");
   auto execPath = _dir.directory() / (_name + ".out");
-
-  std::ofstream output;
-  output.open(srcPath);
-  output << _source;
-  output.close();
-
-  // TODO: handle linking when required, fix hard-coded C compiler
-  auto result = util::exec("/usr/local/bin/clang " + srcPath.string() + " -o " + execPath.string());
-  if (!result.has_value())
+  if (!_compiler->compile(_source, execPath))
   {
     return std::nullopt;
   }
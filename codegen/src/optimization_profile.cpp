@@ -0,0 +1,54 @@
+#include "codegen/optimization_profile.hpp"
+
+#include <array>
+#include <utility>
+
+using jackal::codegen::OptimizationProfile;
+
+namespace
+{
+constexpr std::array<std::pair<std::string_view, OptimizationProfile>, 3> Names{{
+    {"debug", OptimizationProfile::Debug},
+    {"release", OptimizationProfile::Release},
+    {"release-native", OptimizationProfile::ReleaseNative},
+}};
+}  // namespace
+
+auto jackal::codegen::parse_optimization_profile(std::string_view name) noexcept
+    -> std::optional<OptimizationProfile>
+{
+  for (auto const& [profileName, profile] : Names)
+  {
+    if (profileName == name)
+    {
+      return profile;
+    }
+  }
+  return std::nullopt;
+}
+
+auto jackal::codegen::name(OptimizationProfile profile) noexcept -> std::string_view
+{
+  for (auto const& [profileName, named] : Names)
+  {
+    if (named == profile)
+    {
+      return profileName;
+    }
+  }
+  return {};
+}
+
+auto jackal::codegen::c_flags(OptimizationProfile profile) noexcept -> std::vector<std::string>
+{
+  switch (profile)
+  {
+    case OptimizationProfile::Debug:
+      return {"-O0", "-g"};
+    case OptimizationProfile::Release:
+      return {"-O2"};
+    case OptimizationProfile::ReleaseNative:
+      return {"-O3", "-march=native", "-flto"};
+  }
+  return {};
+}
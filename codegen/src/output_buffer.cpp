@@ -0,0 +1,126 @@
+#include "codegen/output_buffer.hpp"
+
+#include <algorithm>
+#include <cassert>
+#include <charconv>
+#include <cmath>
+#include <cstring>
+#include <limits>
+
+using jackal::codegen::OutputBuffer;
+
+namespace
+{
+// Sign and digits of the most negative int64_t
+constexpr std::size_t MaxIntegerChars = std::numeric_limits<int64_t>::digits10 + 2;
+
+// Sign, the digits of the shortest round-trip form, point, exponent and a ".0" suffix
+constexpr std::size_t MaxDoubleChars = std::numeric_limits<double>::max_digits10 + 10;
+}  // namespace
+
+auto OutputBuffer::reserve(std::size_t bytes) noexcept -> void
+{
+  if (!_chunks.empty() && _chunks.back().capacity - _chunks.back().size >= bytes)
+  {
+    return;
+  }
+
+  auto capacity = std::max(DefaultChunkSize, bytes);
+  _chunks.push_back({std::make_unique_for_overwrite<char[]>(capacity), 0, capacity});  // NOLINT
+}
+
+auto OutputBuffer::append(std::string_view bytes) noexcept -> void
+{
+  // Fill whatever is left of the current chunk before starting a new one
+  if (!_chunks.empty())
+  {
+    auto& chunk = _chunks.back();
+    auto fits = std::min(bytes.size(), chunk.capacity - chunk.size);
+    std::memcpy(chunk.data.get() + chunk.size, bytes.data(), fits);
+    chunk.size += fits;
+    _size += fits;
+    bytes.remove_prefix(fits);
+  }
+
+  if (!bytes.empty())
+  {
+    std::memcpy(claim(bytes.size()), bytes.data(), bytes.size());
+  }
+}
+
+auto OutputBuffer::append(char byte) noexcept -> void { *claim(1) = byte; }
+
+auto OutputBuffer::append(int64_t value) noexcept -> void
+{
+  auto* first = claim(MaxIntegerChars);
+  auto [last, ec] = std::to_chars(first, first + MaxIntegerChars, value);
+  assert(ec == std::errc());
+  release(MaxIntegerChars - (last - first));
+}
+
+auto OutputBuffer::append(double value) noexcept -> void
+{
+  // C has no literals for infinity or NaN, but constant expressions can produce them
+  if (std::isnan(value))
+  {
+    append("(0.0 / 0.0)");
+    return;
+  }
+  if (std::isinf(value))
+  {
+    append(value < 0 ? "-(1.0 / 0.0)" : "(1.0 / 0.0)");
+    return;
+  }
+
+  auto* first = claim(MaxDoubleChars);
+  auto [last, ec] = std::to_chars(first, first + MaxDoubleChars - 2, value);
+  assert(ec == std::errc());
+
+  // "1" would be an int literal in C; keep the constant a double
+  if (std::none_of(first, last, [](char c) { return c == '.' || c == 'e'; }))
+  {
+    *last++ = '.';
+    *last++ = '0';
+  }
+  release(MaxDoubleChars - (last - first));
+}
+
+auto OutputBuffer::splice(OutputBuffer&& other) noexcept -> void
+{
+  _chunks.insert(_chunks.end(), std::make_move_iterator(other._chunks.begin()),
+                 std::make_move_iterator(other._chunks.end()));
+  _size += other._size;
+
+  other._chunks.clear();
+  other._size = 0;
+}
+
+auto OutputBuffer::chunks() const noexcept -> std::vector<std::string_view>
+{
+  std::vector<std::string_view> views;
+  views.reserve(_chunks.size());
+  for (auto const& chunk : _chunks)
+  {
+    views.emplace_back(chunk.data.get(), chunk.size);
+  }
+  return views;
+}
+
+auto OutputBuffer::write_to(std::ostream& output) const noexcept -> void
+{
+  for (auto const& chunk : _chunks)
+  {
+    output.write(chunk.data.get(), static_cast<std::streamsize>(chunk.size));
+  }
+}
+
+auto OutputBuffer::str() const noexcept -> std::string
+{
+  std::string contiguous;
+  contiguous.reserve(_size);
+  for (auto const& chunk : _chunks)
+  {
+    contiguous.append(chunk.data.get(), chunk.size);
+  }
+  return contiguous;
+}
@@ -0,0 +1,140 @@
+#include "codegen/sha256.hpp"
+
+#include <algorithm>
+#include <bit>
+
+using jackal::codegen::Sha256;
+
+namespace
+{
+constexpr std::array<uint32_t, 64> RoundConstants{
+    0x428a2f98, 0x71374491, 0xb5c0fbcf, 0xe9b5dba5, 0x3956c25b, 0x59f111f1, 0x923f82a4, 0xab1c5ed5,
+    0xd807aa98, 0x12835b01, 0x243185be, 0x550c7dc3, 0x72be5d74, 0x80deb1fe, 0x9bdc06a7, 0xc19bf174,
+    0xe49b69c1, 0xefbe4786, 0x0fc19dc6, 0x240ca1cc, 0x2de92c6f, 0x4a7484aa, 0x5cb0a9dc, 0x76f988da,
+    0x983e5152, 0xa831c66d, 0xb00327c8, 0xbf597fc7, 0xc6e00bf3, 0xd5a79147, 0x06ca6351, 0x14292967,
+    0x27b70a85, 0x2e1b2138, 0x4d2c6dfc, 0x53380d13, 0x650a7354, 0x766a0abb, 0x81c2c92e, 0x92722c85,
+    0xa2bfe8a1, 0xa81a664b, 0xc24b8b70, 0xc76c51a3, 0xd192e819, 0xd6990624, 0xf40e3585, 0x106aa070,
+    0x19a4c116, 0x1e376c08, 0x2748774c, 0x34b0bcb5, 0x391c0cb3, 0x4ed8aa4a, 0x5b9cca4f, 0x682e6ff3,
+    0x748f82ee, 0x78a5636f, 0x84c87814, 0x8cc70208, 0x90befffa, 0xa4506ceb, 0xbef9a3f7, 0xc67178f2};
+
+constexpr auto load_big_endian(uint8_t const* bytes) noexcept -> uint32_t
+{
+  return (uint32_t{bytes[0]} << 24U) | (uint32_t{bytes[1]} << 16U) | (uint32_t{bytes[2]} << 8U) |
+         uint32_t{bytes[3]};
+}
+}  // namespace
+
+auto Sha256::update(std::string_view bytes) noexcept -> void
+{
+  _length += bytes.size();
+  auto const* data = reinterpret_cast<uint8_t const*>(bytes.data());  // NOLINT
+  auto remaining = bytes.size();
+
+  if (_blockSize > 0)
+  {
+    auto fill = std::min(remaining, BlockSize - _blockSize);
+    std::copy_n(data, fill, _block.begin() + _blockSize);
+    _blockSize += fill;
+    data += fill;
+    remaining -= fill;
+    if (_blockSize < BlockSize)
+    {
+      return;
+    }
+    compress(_block.data());
+    _blockSize = 0;
+  }
+
+  for (; remaining >= BlockSize; data += BlockSize, remaining -= BlockSize)
+  {
+    compress(data);
+  }
+
+  std::copy_n(data, remaining, _block.begin());
+  _blockSize = remaining;
+}
+
+auto Sha256::finish() noexcept -> Digest
+{
+  // Pad with a single set bit, zeros, and the message length in bits, to a whole block
+  auto bits = _length * 8;
+  _block.at(_blockSize++) = 0x80;
+  if (_blockSize > BlockSize - 8)
+  {
+    std::fill(_block.begin() + _blockSize, _block.end(), 0);
+    compress(_block.data());
+    _blockSize = 0;
+  }
+  std::fill(_block.begin() + _blockSize, _block.end() - 8, 0);
+  for (auto i = 0; i < 8; ++i)
+  {
+    _block.at(BlockSize - 1 - i) = static_cast<uint8_t>(bits >> (8U * i));
+  }
+  compress(_block.data());
+
+  Digest digest;
+  for (std::size_t i = 0; i < _state.size(); ++i)
+  {
+    for (std::size_t j = 0; j < 4; ++j)
+    {
+      digest.at(i * 4 + j) = static_cast<uint8_t>(_state.at(i) >> (24U - 8U * j));
+    }
+  }
+  return digest;
+}
+
+auto Sha256::hex(Digest const& digest) noexcept -> std::string
+{
+  static constexpr std::string_view Digits = "0123456789abcdef";
+  std::string text;
+  text.reserve(digest.size() * 2);
+  for (auto byte : digest)
+  {
+    text += Digits[byte >> 4U];
+    text += Digits[byte & 0xfU];
+  }
+  return text;
+}
+
+auto Sha256::compress(uint8_t const* block) noexcept -> void
+{
+  std::array<uint32_t, 64> schedule;  // NOLINT
+  for (std::size_t i = 0; i < 16; ++i)
+  {
+    schedule.at(i) = load_big_endian(block + i * 4);
+  }
+  for (std::size_t i = 16; i < schedule.size(); ++i)
+  {
+    auto w15 = schedule.at(i - 15);
+    auto w2 = schedule.at(i - 2);
+    auto s0 = std::rotr(w15, 7) ^ std::rotr(w15, 18) ^ (w15 >> 3U);
+    auto s1 = std::rotr(w2, 17) ^ std::rotr(w2, 19) ^ (w2 >> 10U);
+    schedule.at(i) = schedule.at(i - 16) + s0 + schedule.at(i - 7) + s1;
+  }
+
+  auto [a, b, c, d, e, f, g, h] = _state;
+  for (std::size_t i = 0; i < schedule.size(); ++i)
+  {
+    auto s1 = std::rotr(e, 6) ^ std::rotr(e, 11) ^ std::rotr(e, 25);
+    auto choice = (e & f) ^ (~e & g);
+    auto t1 = h + s1 + choice + RoundConstants.at(i) + schedule.at(i);
+    auto s0 = std::rotr(a, 2) ^ std::rotr(a, 13) ^ std::rotr(a, 22);
+    auto majority = (a & b) ^ (a & c) ^ (b & c);
+    auto t2 = s0 + majority;
+
+    h = g;
+    g = f;
+    f = e;
+    e = d + t1;
+    d = c;
+    c = b;
+    b = a;
+    a = t1 + t2;
+  }
+
+  std::array<uint32_t, 8> const working{a, b, c, d, e, f, g, h};
+  for (std::size_t i = 0; i < _state.size(); ++i)
+  {
+    _state.at(i) += working.at(i);
+  }
+}
@@ -0,0 +1,112 @@
+/// @file Measures lexer throughput in tokens per second.
+///
+/// Usage: jackal_lexer_benchmark [SOURCE_FILE]
+///
+/// When no source file is provided, a large synthetic program is generated in memory. Three
+/// workloads are measured: plain sequential lexing, sequential lexing that interns identifiers,
+/// and the parser's access pattern of peeking the next token twice before consuming it.
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <fstream>
+#include <iostream>
+#include <sstream>
+#include <string>
+
+#include "lexer/lexer.hpp"
+#include "lexer/token.hpp"
+#include "util/interner.hpp"
+
+using jackal::lexer::Lexer;
+using jackal::lexer::Token;
+
+namespace
+{
+constexpr auto Iterations = 10;
+constexpr auto SyntheticLines = 200000;
+
+auto synthetic_source() -> std::string
+{
+  std::ostringstream oss;
+  for (auto i = 0; i < SyntheticLines; ++i)
+  {
+    oss << "let value_" << i << " = value_" << i / 2 << " + " << i << "\n";
+    oss << "print value_" << i << " + 12190.5\n";
+  }
+  return oss.str();
+}
+
+auto lex_sequential(char const* code) -> std::size_t
+{
+  Lexer lexer(code);
+  std::size_t tokens = 0;
+  while (lexer.next().kind() != Token::Kind::Halt)
+  {
+    ++tokens;
+  }
+  return tokens;
+}
+
+auto lex_interned(char const* code) -> std::size_t
+{
+  jackal::util::Interner interner;
+  Lexer lexer(code, interner);
+  std::size_t tokens = 0;
+  while (lexer.next().kind() != Token::Kind::Halt)
+  {
+    ++tokens;
+  }
+  return tokens;
+}
+
+auto lex_with_peeks(char const* code) -> std::size_t
+{
+  Lexer lexer(code);
+  std::size_t tokens = 0;
+  while (lexer.peek_token<0>().kind() != Token::Kind::Halt)
+  {
+    static_cast<void>(lexer.peek_token<0>());
+    static_cast<void>(lexer.peek_token<1>());
+    lexer.next();
+    ++tokens;
+  }
+  return tokens;
+}
+
+template <typename Workload>
+void measure(std::string_view name, std::string const& source, Workload workload)
+{
+  std::size_t tokens = 0;
+  auto start = std::chrono::steady_clock::now();
+  for (auto i = 0; i < Iterations; ++i)
+  {
+    tokens += workload(source.c_str());
+  }
+  std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+
+  std::cout << name << ": " << tokens / Iterations << " tokens, "
+            << static_cast<uint64_t>(static_cast<double>(tokens) / elapsed.count())
+            << " tokens/sec" << std::endl;
+}
+}  // namespace
+
+auto main(int argc, char** argv) -> int
+{
+  std::string source;
+  if (argc > 1)
+  {
+    std::ifstream inputStream(argv[1]);  // NOLINT
+    std::stringstream iss;
+    iss << inputStream.rdbuf();
+    source = iss.str();
+  }
+  else
+  {
+    source = synthetic_source();
+  }
+
+  std::cout << "Source size: " << source.size() << " bytes" << std::endl;
+  measure("sequential", source, lex_sequential);
+  measure("interned", source, lex_interned);
+  measure("peek-heavy", source, lex_with_peeks);
+}
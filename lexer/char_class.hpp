@@ -0,0 +1,54 @@
+#pragma once
+
+#include <array>
+#include <cstdint>
+
+namespace jackal::lexer::char_class
+{
+/// @brief Character classes recognized by the lexer.
+///
+/// Classes are bit flags so that a single table lookup can answer membership of any union of
+/// classes.
+enum Class : uint8_t
+{
+  Digit = 1U << 0U,
+  Lower = 1U << 1U,
+  Upper = 1U << 2U,
+  Underscore = 1U << 3U
+};
+
+/// @brief Maps every byte value to the union of the character classes it belongs to.
+///
+/// Unlike the <cctype> functions, lookups are independent of the current locale; only ASCII
+/// characters are members of any class.
+constexpr std::array<uint8_t, 256> Table = []
+{
+  std::array<uint8_t, 256> table{};
+  for (auto c = '0'; c <= '9'; ++c)
+  {
+    table[static_cast<unsigned char>(c)] |= Digit;
+  }
+  for (auto c = 'a'; c <= 'z'; ++c)
+  {
+    table[static_cast<unsigned char>(c)] |= Lower;
+  }
+  for (auto c = 'A'; c <= 'Z'; ++c)
+  {
+    table[static_cast<unsigned char>(c)] |= Upper;
+  }
+  table[static_cast<unsigned char>('_')] |= Underscore;
+  return table;
+}();
+
+/// @returns whether @p c is a member of any of the classes in @p classes
+[[nodiscard]] constexpr bool is(char c, uint8_t classes) noexcept
+{
+  return (Table[static_cast<unsigned char>(c)] & classes) != 0;
+}
+
+[[nodiscard]] constexpr bool is_digit(char c) noexcept { return is(c, Digit); }
+
+[[nodiscard]] constexpr bool is_lower(char c) noexcept { return is(c, Lower); }
+
+[[nodiscard]] constexpr bool is_alpha(char c) noexcept { return is(c, Lower | Upper); }
+}  // namespace jackal::lexer::char_class
@@ -1,6 +1,7 @@
 #pragma once
 
 #include <cstdint>
+#include <vector>
 
 #include "util/source_location.hpp"
 
@@ -11,8 +12,22 @@ namespace jackal::lexer
 /// The GPS is an implementation detail of the lexer that allows for each Token
 /// to be easily tagged with its corresponding SourceLocation during the incremental
 /// lexing process.
+///
+/// The start of every line encountered so far is recorded in a line table that is extended
+/// lazily as the lexer moves through the source, so any previously lexed line can be recovered
+/// in constant time without rescanning the source.
+///
+/// Line starts are stored as offsets from the beginning of the source rather than as pointers so
+/// that a streaming lexer can move its input window without invalidating the table.
 struct GPS
 {
+  /// @brief A saved position that the GPS can be rewound to.
+  struct Mark
+  {
+    uint64_t column;
+    uint64_t lines;
+  };
+
   /// @brief Constructs a GPS from the source code.
   ///
   /// @param line a pointer to the beginning of a source file
@@ -27,9 +42,36 @@ struct GPS
   /// @returns the current SourceLocation
   [[nodiscard]] util::SourceLocation current_location() const noexcept;
 
+  /// @param lineNum the 0-based index of a line that has already been reached by the GPS
+  /// @returns the requested Line
+  [[nodiscard]] util::Line line(uint64_t lineNum) const noexcept;
+
+  /// @returns the number of lines that have been reached by the GPS
+  [[nodiscard]] uint64_t line_count() const noexcept;
+
+  /// @returns the current position, which can later be restored using rewind
+  [[nodiscard]] Mark mark() const noexcept;
+
+  /// @brief Restores a position previously returned by mark.
+  void rewind(Mark mark) noexcept;
+
+  /// @returns the offset of @p code from the beginning of the source
+  [[nodiscard]] uint64_t offset(char const* code) const noexcept;
+
+  /// @brief Informs the GPS that the source has moved in memory.
+  ///
+  /// Lines that end before @p offset are no longer available after rebasing, and the line
+  /// containing @p offset is truncated to begin there.
+  ///
+  /// @param base the new location in memory of the source at @p offset
+  /// @param offset the offset from the beginning of the source that @p base corresponds to
+  void rebase(char const* base, uint64_t offset) noexcept;
+
  private:
-  util::Line _line;
-  uint64_t _lineNum = 0;
+  char const* _base;
+  uint64_t _baseOffset = 0;
+  std::vector<uint64_t> _lineOffsets{0};
+  uint64_t _discardedLines = 0;
   uint64_t _column = 0;
 };
 }  // namespace jackal::lexer
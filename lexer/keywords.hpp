@@ -0,0 +1,128 @@
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+
+#include "util/keywords.hpp"
+
+namespace jackal::lexer::keywords
+{
+/// @brief The lexical category of a word consisting only of [a-z0-9].
+enum class Classification : uint8_t
+{
+  Identifier,
+  Keyword,
+  Boolean
+};
+
+constexpr std::array<std::string_view, 2> BooleanLiterals{"true", "false"};
+
+/// @brief A word that is recognized by the lexer along with its category.
+struct Reserved
+{
+  std::string_view word;
+  Classification classification = Classification::Identifier;
+};
+
+constexpr auto AllReserved = []
+{
+  std::array<Reserved, util::keyword::AllKeywords.size() + BooleanLiterals.size()> reserved{};
+  auto it = std::transform(util::keyword::AllKeywords.begin(), util::keyword::AllKeywords.end(),
+                           reserved.begin(),
+                           [](auto kw)
+                           {
+                             return Reserved{kw, Classification::Keyword};
+                           });
+  std::transform(BooleanLiterals.begin(), BooleanLiterals.end(), it,
+                 [](auto literal)
+                 {
+                   return Reserved{literal, Classification::Boolean};
+                 });
+  return reserved;
+}();
+
+/// @brief Seeded FNV-1a hash used to index the reserved word table.
+[[nodiscard]] constexpr uint32_t hash(std::string_view word, uint32_t seed) noexcept
+{
+  constexpr uint32_t Prime = 16777619U;
+  uint32_t h = 2166136261U ^ seed;
+  for (auto c : word)
+  {
+    h = (h ^ static_cast<unsigned char>(c)) * Prime;
+  }
+  return h;
+}
+
+/// @brief A collision-free hash table over all reserved words.
+///
+/// The table is constructed entirely at compile time from util::keyword::AllKeywords and
+/// BooleanLiterals by searching for a hash seed that places every reserved word in a distinct slot.
+/// Adding a keyword requires no other changes; compilation fails if no perfect seed exists.
+struct PerfectHash
+{
+  static constexpr std::size_t Size = std::bit_ceil(AllReserved.size() * 2);
+  static constexpr std::size_t MaxSeed = 1U << 16U;
+
+  static constexpr std::size_t MinLength =
+      std::min_element(AllReserved.begin(), AllReserved.end(),
+                       [](auto const& a, auto const& b)
+                       {
+                         return a.word.size() < b.word.size();
+                       })
+          ->word.size();
+  static constexpr std::size_t MaxLength =
+      std::max_element(AllReserved.begin(), AllReserved.end(),
+                       [](auto const& a, auto const& b)
+                       {
+                         return a.word.size() < b.word.size();
+                       })
+          ->word.size();
+
+  static constexpr uint32_t Seed = []
+  {
+    for (uint32_t seed = 0; seed < MaxSeed; ++seed)
+    {
+      std::array<bool, Size> occupied{};
+      bool collision = false;
+      for (auto const& reserved : AllReserved)
+      {
+        auto slot = hash(reserved.word, seed) % Size;
+        collision = collision || occupied[slot];
+        occupied[slot] = true;
+      }
+      if (!collision)
+      {
+        return seed;
+      }
+    }
+    return static_cast<uint32_t>(MaxSeed);
+  }();
+  static_assert(Seed < MaxSeed, "no perfect hash seed exists for the reserved words");
+
+  static constexpr std::array<Reserved, Size> Table = []
+  {
+    std::array<Reserved, Size> table{};
+    for (auto const& reserved : AllReserved)
+    {
+      table[hash(reserved.word, Seed) % Size] = reserved;
+    }
+    return table;
+  }();
+};
+
+/// @brief Classifies a lexed word using a single hash and a single comparison.
+[[nodiscard]] constexpr Classification classify(std::string_view word) noexcept
+{
+  if (word.size() < PerfectHash::MinLength || word.size() > PerfectHash::MaxLength)
+  {
+    return Classification::Identifier;
+  }
+
+  auto const& candidate = PerfectHash::Table[hash(word, PerfectHash::Seed) % PerfectHash::Size];
+  return candidate.word == word ? candidate.classification : Classification::Identifier;
+}
+}  // namespace jackal::lexer::keywords
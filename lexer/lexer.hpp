@@ -1,14 +1,18 @@
 #pragma once
 
 #include <cstddef>
-#include <iterator>
-#include <list>
+#include <cstdint>
 #include <string_view>
 #include <type_traits>
 #include <utility>
+#include <vector>
 
 #include "lexer/gps.hpp"
+#include "lexer/ring_buffer.hpp"
+#include "lexer/stream_source.hpp"
 #include "lexer/token.hpp"
+#include "util/interner.hpp"
+#include "util/source_location.hpp"
 
 namespace jackal::lexer
 {
@@ -16,8 +20,31 @@ struct Lexer
 {
   static constexpr std::size_t MAX_LOOKAHEAD = 4;
 
+  /// The number of tokens returned by next for which a streamed lexeme remains valid
+  static constexpr std::size_t PinnedTokens = MAX_LOOKAHEAD;
+
   explicit Lexer(char const* code) : _code(code), _gps(_code) {}
 
+  /// @brief Constructs a Lexer that reads its input incrementally from @p source.
+  ///
+  /// Only a bounded window of the input is kept in memory. The lexeme and line of a Token remain
+  /// valid while it is buffered as lookahead and until PinnedTokens further tokens have been
+  /// returned by next; callers that retain lexemes for longer must copy them. A line that began
+  /// before the window is truncated to begin at the window, and one that has not been fully read
+  /// is truncated at the end of the window. A token longer than StreamSource::max_retained is
+  /// returned in pieces, the first of which is Unknown.
+  explicit Lexer(StreamSource& source)
+      : _code(source.data()), _gps(_code), _stream(&source), _generations{{source.generation(), 0}}
+  {
+  }
+
+  /// @brief Constructs a Lexer that interns the lexeme of every identifier into @p interner.
+  ///
+  /// The resulting Symbol is available from Token::symbol and, unlike the lexeme, remains valid
+  /// for as long as @p interner.
+  Lexer(char const* code, util::Interner& interner) : Lexer(code) { _interner = &interner; }
+  Lexer(StreamSource& source, util::Interner& interner) : Lexer(source) { _interner = &interner; }
+
   Token next() noexcept;
 
   template <std::size_t N,
@@ -25,9 +52,7 @@ struct Lexer
   {
     if (_peek.size() > N)
     {
-      auto it = _peek.begin();
-      std::advance(it, N);
-      return *it;
+      return _peek[N];
     }
 
     if (is_halted())
@@ -35,9 +60,9 @@ struct Lexer
       return next();
     }
 
-    while (_peek.size() < N + 1 && _peek.back().kind() != Token::Kind::Halt)
+    while (_peek.size() < N + 1 && (_peek.empty() || _peek.back().kind() != Token::Kind::Halt))
     {
-      _peek.emplace_back(_next());
+      _peek.push_back(_next());
     }
 
     return _peek.back();
@@ -45,12 +70,15 @@ struct Lexer
 
   [[nodiscard]] bool is_halted() noexcept;
 
+  [[nodiscard]] util::Line line(uint64_t lineNum) const noexcept;
+
  private:
   [[nodiscard]] char peek() const noexcept;
   [[nodiscard]] char peek_n(std::size_t n) const noexcept;
 
   char const* get() noexcept;
   std::pair<char const*, char const*> get(std::size_t n) noexcept;
+  void advance(std::size_t n) noexcept;
 
   Token tok_unary(Token::Kind kind) noexcept;
   Token tok_unknown() noexcept;
@@ -62,11 +90,30 @@ struct Lexer
   Token tok_is() noexcept;
   Token tok_returns() noexcept;
 
+  Token lex() noexcept;
+  Token intern(Token token) noexcept;
   Token _next() noexcept;
+  void refill(char const* keep) noexcept;
 
  private:
+  // Lexing may inspect up to two characters beyond the end of a token, so streamed tokens that
+  // end this close to the end of the window may be incomplete
+  static constexpr std::ptrdiff_t StreamMargin = 2;
+
+  // The first token lexed from each buffer of a StreamSource that may still be referenced
+  struct Generation
+  {
+    uint64_t generation;
+    uint64_t firstToken;
+  };
+
   char const* _code;
   GPS _gps;
-  std::list<Token> _peek;
+  RingBuffer<Token, MAX_LOOKAHEAD> _peek;
+  StreamSource* _stream = nullptr;
+  util::Interner* _interner = nullptr;
+  std::vector<Generation> _generations;
+  uint64_t _lexed = 0;
+  uint64_t _returned = 0;
 };
 }  // namespace jackal::lexer
@@ -0,0 +1,62 @@
+#pragma once
+
+#include <array>
+#include <cassert>
+#include <cstddef>
+#include <optional>
+#include <utility>
+
+namespace jackal::lexer
+{
+/// @brief A fixed-capacity FIFO queue with inline storage.
+///
+/// Used by the Lexer to buffer lookahead tokens without allocating. Capacity is a compile-time
+/// constant; pushing to a full buffer is a programmer error.
+///
+/// @tparam T the buffered element type
+/// @tparam N the maximum number of buffered elements
+template <typename T, std::size_t N>
+struct RingBuffer
+{
+  static_assert(N > 0, "RingBuffer requires a non-zero capacity");
+
+  [[nodiscard]] constexpr std::size_t size() const noexcept { return _size; }
+
+  [[nodiscard]] constexpr bool empty() const noexcept { return _size == 0; }
+
+  [[nodiscard]] constexpr bool full() const noexcept { return _size == N; }
+
+  /// @returns the element @p idx positions from the front of the buffer
+  [[nodiscard]] constexpr T const& operator[](std::size_t idx) const noexcept
+  {
+    assert(idx < _size);
+    return *_slots[(_head + idx) % N];
+  }
+
+  [[nodiscard]] constexpr T const& front() const noexcept { return (*this)[0]; }
+
+  [[nodiscard]] constexpr T const& back() const noexcept { return (*this)[_size - 1]; }
+
+  constexpr void push_back(T value) noexcept
+  {
+    assert(!full());
+    _slots[(_head + _size) % N] = std::move(value);
+    ++_size;
+  }
+
+  /// @returns the element that was removed from the front of the buffer
+  constexpr T pop_front() noexcept
+  {
+    assert(!empty());
+    T value = std::move(*_slots[_head]);
+    _head = (_head + 1) % N;
+    --_size;
+    return value;
+  }
+
+ private:
+  std::array<std::optional<T>, N> _slots{};
+  std::size_t _head = 0;
+  std::size_t _size = 0;
+};
+}  // namespace jackal::lexer
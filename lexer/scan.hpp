@@ -0,0 +1,72 @@
+/// @file Bulk scanning of character runs within NUL-terminated source code.
+///
+/// Each function returns the length of the longest prefix of its input made up entirely of the
+/// corresponding character class. Scanning always stops at the NUL terminator, which is not a
+/// member of any run.
+///
+/// On x86-64, runs are located 16 or 32 bytes at a time using SSE2 or AVX2 depending upon the
+/// capabilities of the executing processor, which are detected once at startup. Vector loads are
+/// aligned so that they never cross into a page past the terminator. Other architectures use a
+/// table-driven scalar scan, which can also be selected at run time on x86-64.
+#pragma once
+
+#include <cstddef>
+#include <optional>
+#include <string_view>
+
+namespace jackal::lexer::scan
+{
+/// @returns the length of the run of [0-9] beginning at @p code
+[[nodiscard]] std::size_t digits(char const* code) noexcept;
+
+/// @returns the length of the run of [a-z0-9] beginning at @p code
+[[nodiscard]] std::size_t alphalower_or_number(char const* code) noexcept;
+
+/// @returns the length of the run of [a-z0-9_] beginning at @p code
+[[nodiscard]] std::size_t value_identifier(char const* code) noexcept;
+
+/// @returns the length of the run of [a-zA-Z0-9] beginning at @p code
+[[nodiscard]] std::size_t alphanumeric(char const* code) noexcept;
+
+/// @returns the length of the run of characters other than '"' beginning at @p code
+[[nodiscard]] std::size_t string_body(char const* code) noexcept;
+
+namespace detail
+{
+/// @brief An instruction set that runs can be scanned with.
+enum class Isa
+{
+  Scalar,
+  Sse2,
+  Avx2
+};
+
+[[nodiscard]] std::string_view name(Isa isa) noexcept;
+
+using ScanFunction = std::size_t (*)(char const*) noexcept;
+
+/// @brief One implementation of every scan function, all using the same instruction set.
+struct Scanners
+{
+  ScanFunction digits;
+  ScanFunction alphalowerOrNumber;
+  ScanFunction valueIdentifier;
+  ScanFunction alphanumeric;
+  ScanFunction stringBody;
+};
+
+/// @returns the scanners implemented with @p isa, or std::nullopt if this build or the executing
+/// processor does not support it
+[[nodiscard]] std::optional<Scanners> scanners(Isa isa) noexcept;
+
+/// @returns the fastest instruction set supported here, which the scan functions use by default
+[[nodiscard]] Isa best() noexcept;
+
+/// @brief Makes the scan functions use @p isa from now on.
+///
+/// Must not be called while another thread is scanning.
+///
+/// @returns whether @p isa is supported; the selection is unchanged if it is not
+bool select(Isa isa) noexcept;
+}  // namespace detail
+}  // namespace jackal::lexer::scan
@@ -0,0 +1 @@
+#include "lexer/char_class.hpp"
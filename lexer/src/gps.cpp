@@ -1,20 +1,60 @@
 #include "lexer/gps.hpp"
 
+#include <algorithm>
+#include <cassert>
+#include <iterator>
+
 #include "util/source_location.hpp"
 
 using jackal::lexer::GPS;
 
-GPS::GPS(char const* line) noexcept : _line(line, 0) {}
+GPS::GPS(char const* line) noexcept : _base(line) {}
 
 auto GPS::column_moved(uint64_t chars) noexcept -> void { _column += chars; }
 
 auto GPS::line_moved(char const* line) noexcept -> void
 {
   _column = 0;
-  _line = util::Line(line, ++_lineNum);
+  _lineOffsets.push_back(offset(line));
 }
 
 auto GPS::current_location() const noexcept -> util::SourceLocation
 {
-  return {_line, util::column(_column)};
+  return {line(line_count() - 1), util::column(_column)};
+}
+
+auto GPS::line(uint64_t lineNum) const noexcept -> util::Line
+{
+  assert(lineNum >= _discardedLines && lineNum < line_count());
+  return {_base + (_lineOffsets[lineNum - _discardedLines] - _baseOffset), lineNum};  // NOLINT
+}
+
+auto GPS::line_count() const noexcept -> uint64_t
+{
+  return _discardedLines + _lineOffsets.size();
+}
+
+auto GPS::mark() const noexcept -> Mark { return {_column, line_count()}; }
+
+auto GPS::rewind(Mark mark) noexcept -> void
+{
+  _column = mark.column;
+  _lineOffsets.resize(mark.lines - _discardedLines);
+}
+
+auto GPS::offset(char const* code) const noexcept -> uint64_t
+{
+  return _baseOffset + static_cast<uint64_t>(code - _base);
+}
+
+auto GPS::rebase(char const* base, uint64_t offset) noexcept -> void
+{
+  // The line containing the new base remains available, beginning at the base
+  assert(offset >= _baseOffset);
+  auto retained = std::prev(std::upper_bound(_lineOffsets.begin(), _lineOffsets.end(), offset));
+  _discardedLines += static_cast<uint64_t>(retained - _lineOffsets.begin());
+  _lineOffsets.erase(_lineOffsets.begin(), retained);
+  _lineOffsets.front() = offset;
+  _base = base;
+  _baseOffset = offset;
 }
@@ -0,0 +1 @@
+#include "lexer/keywords.hpp"
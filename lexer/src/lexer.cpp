@@ -1,35 +1,23 @@
 #include "lexer/lexer.hpp"
 
 #include <algorithm>
-#include <cctype>
 #include <cstddef>
+#include <cstdint>
+#include <iterator>
 #include <string_view>
 #include <utility>
 
+#include "lexer/char_class.hpp"
+#include "lexer/keywords.hpp"
+#include "lexer/scan.hpp"
 #include "lexer/token.hpp"
-#include "util/keywords.hpp"
+#include "util/source_location.hpp"
 
 using jackal::lexer::Lexer;
 
-namespace
-{
-auto is_boolean(std::string_view view) -> bool { return view == "true" || view == "false"; }
-
-auto is_keyword(std::string_view view) -> bool
-{
-  return std::any_of(jackal::util::keyword::AllKeywords.begin(),
-                     jackal::util::keyword::AllKeywords.end(),
-                     [view](auto kw)
-                     {
-                       return kw == view;
-                     });
-}
-
-auto is_alphalower_or_number(char c) -> bool
-{
-  return isdigit(c) != 0 || (isalpha(c) != 0 && islower(c) != 0);
-}
-}  // namespace
+namespace char_class = jackal::lexer::char_class;
+namespace keywords = jackal::lexer::keywords;
+namespace scan = jackal::lexer::scan;
 
 auto Lexer::peek() const noexcept -> char { return *_code; }
 
@@ -52,6 +40,12 @@ auto Lexer::get(std::size_t n) noexcept -> std::pair<char const*, char const*>
   return std::make_pair(begin, _code);
 }
 
+auto Lexer::advance(std::size_t n) noexcept -> void
+{
+  _gps.column_moved(n);
+  _code += n;  // NOLINT
+}
+
 auto Lexer::tok_unary(Token::Kind kind) noexcept -> Token
 {
   auto loc = _gps.current_location();
@@ -69,25 +63,18 @@ auto Lexer::tok_unknown() noexcept -> Token { return tok_unary(Token::Kind::Unkn
 auto Lexer::tok_number() noexcept -> Token
 {
   auto loc = _gps.current_location();
-  char const* lexemeBegin = get();
-  while (isdigit(peek()) != 0)
-  {
-    get();
-  }
+  char const* lexemeBegin = _code;
+  advance(scan::digits(_code));
   if (peek() == '.')
   {
-    if (isdigit(peek_n(2)) == 0)
+    if (!char_class::is_digit(peek_n(1)))
     {
       get();
       return {Token::Kind::Unknown, loc, lexemeBegin, _code};
     }
 
     get();
-    get();
-  }
-  while (isdigit(peek()) != 0)
-  {
-    get();
+    advance(scan::digits(_code));
   }
 
   return {Token::Kind::Number, loc, lexemeBegin, _code};
@@ -109,11 +96,8 @@ auto Lexer::tok_string() noexcept -> Token
 {
   auto loc = _gps.current_location();
   char const* lexemeBegin = get();
-  while (!is_halted() && peek() != '"')
-  {
-    get();
-  }
-  if (is_halted())
+  advance(scan::string_body(_code));
+  if (peek() == '\0')
   {
     return {Token::Kind::Unknown, loc, lexemeBegin, _code};
   }
@@ -125,29 +109,23 @@ auto Lexer::tok_string() noexcept -> Token
 auto Lexer::tok_alphalower() noexcept -> Token
 {
   auto loc = _gps.current_location();
-  char const* lexemeBegin = get();
-  while (is_alphalower_or_number(peek()))
-  {
-    get();
-  }
+  char const* lexemeBegin = _code;
+  advance(scan::alphalower_or_number(_code));
 
   if (peek() != '_')
   {
-    std::string_view view(lexemeBegin, _code);
-    if (is_boolean(view))
-    {
-      return {Token::Kind::Boolean, loc, lexemeBegin, _code};
-    }
-    if (is_keyword(view))
+    switch (keywords::classify(std::string_view(lexemeBegin, _code)))
     {
-      return {Token::Kind::Keyword, loc, lexemeBegin, _code};
+      case keywords::Classification::Boolean:
+        return {Token::Kind::Boolean, loc, lexemeBegin, _code};
+      case keywords::Classification::Keyword:
+        return {Token::Kind::Keyword, loc, lexemeBegin, _code};
+      case keywords::Classification::Identifier:
+        break;
     }
   }
 
-  while (peek() == '_' || is_alphalower_or_number(peek()))
-  {
-    get();
-  }
+  advance(scan::value_identifier(_code));
 
   return {Token::Kind::ValueIdentifier, loc, lexemeBegin, _code};
 }
@@ -155,11 +133,8 @@ auto Lexer::tok_alphalower() noexcept -> Token
 auto Lexer::tok_type_identifier() noexcept -> Token
 {
   auto loc = _gps.current_location();
-  char const* lexemeBegin = get();
-  while (isalpha(peek()) != 0 || isdigit(peek()) != 0)
-  {
-    get();
-  }
+  char const* lexemeBegin = _code;
+  advance(scan::alphanumeric(_code));
 
   return {Token::Kind::TypeIdentifier, loc, lexemeBegin, _code};
 }
@@ -190,17 +165,82 @@ auto Lexer::tok_returns() noexcept -> Token
 
 auto Lexer::next() noexcept -> Token
 {
-  if (!_peek.empty())
+  auto token = _peek.empty() ? _next() : _peek.pop_front();
+  ++_returned;
+  return token;
+}
+
+auto Lexer::intern(Token token) noexcept -> Token
+{
+  if (_interner == nullptr ||
+      (token.kind() != Token::Kind::ValueIdentifier && token.kind() != Token::Kind::TypeIdentifier))
   {
-    auto token = _peek.front();
-    _peek.pop_front();
     return token;
   }
 
-  return _next();
+  return token.interned(_interner->intern(token.lexeme()));
 }
 
 auto Lexer::_next() noexcept -> Token
+{
+  if (_stream == nullptr) [[likely]]
+  {
+    return intern(lex());
+  }
+
+  for (;;)
+  {
+    // Spaces are consumed before the token so that they are never carried over by a refill
+    while (peek() == ' ')
+    {
+      get();
+    }
+
+    char const* begin = _code;
+    auto mark = _gps.mark();
+    auto token = lex();
+    if (_stream->exhausted() || _stream->end() - _code > StreamMargin)
+    {
+      ++_lexed;
+      return intern(token);
+    }
+
+    // A token that cannot be carried over whole is split rather than growing the window
+    if (static_cast<std::size_t>(_stream->end() - begin) > _stream->max_retained())
+    {
+      ++_lexed;
+      return {Token::Kind::Unknown, token.location(), begin, _code};
+    }
+
+    // The token may continue beyond the window; lex it again once more input is available
+    _code = begin;
+    _gps.rewind(mark);
+    refill(begin);
+  }
+}
+
+auto Lexer::refill(char const* keep) noexcept -> void
+{
+  auto keepOffset = _gps.offset(keep);
+  _code = _stream->refill(keep);
+  _gps.rebase(_code, keepOffset);
+
+  // Tokens lexed from here on belong to the new buffer. Earlier buffers are released once no
+  // buffered token and none of the last PinnedTokens returned tokens can refer to them.
+  if (_generations.back().firstToken == _lexed)
+  {
+    _generations.pop_back();
+  }
+  _generations.push_back({_stream->generation(), _lexed});
+
+  auto pinned = _returned > PinnedTokens ? _returned - PinnedTokens : 0;
+  auto unused = std::find_if(_generations.begin() + 1, _generations.end(),
+                             [pinned](auto const& gen) { return gen.firstToken > pinned; });
+  _generations.erase(_generations.begin(), std::prev(unused));
+  _stream->release(_generations.front().generation);
+}
+
+auto Lexer::lex() noexcept -> Token
 {
   while (peek() == ' ')
   {
@@ -224,6 +264,10 @@ auto Lexer::_next() noexcept -> Token
   {
     return tok_unary(Token::Kind::Equal);
   }
+  if (current == '+')
+  {
+    return tok_unary(Token::Kind::Plus);
+  }
   if (current == '.')
   {
     return tok_unary(Token::Kind::Dot);
@@ -272,13 +316,13 @@ auto Lexer::_next() noexcept -> Token
   {
     return tok_string();
   }
-  if (isdigit(current) != 0)
+  if (char_class::is_digit(current))
   {
     return tok_number();
   }
-  if (isalpha(current) != 0)
+  if (char_class::is_alpha(current))
   {
-    if (islower(current) != 0)
+    if (char_class::is_lower(current))
     {
       return tok_alphalower();
     }
@@ -289,4 +333,15 @@ auto Lexer::_next() noexcept -> Token
   return tok_unknown();
 }
 
-auto Lexer::is_halted() noexcept -> bool { return _peek.empty() && peek() == '\0'; }
+auto Lexer::is_halted() noexcept -> bool
+{
+  while (_stream != nullptr && _peek.empty() && _code == _stream->end() && !_stream->exhausted())
+    [[unlikely]]
+    {
+      refill(_code);
+    }
+
+  return _peek.empty() && peek() == '\0';
+}
+
+auto Lexer::line(uint64_t lineNum) const noexcept -> util::Line { return _gps.line(lineNum); }
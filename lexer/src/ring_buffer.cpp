@@ -0,0 +1 @@
+#include "lexer/ring_buffer.hpp"
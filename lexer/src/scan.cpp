@@ -0,0 +1,335 @@
+#include "lexer/scan.hpp"
+
+#include <cstddef>
+#include <cstdint>
+
+#include "lexer/char_class.hpp"
+
+#if defined(__x86_64__) && (defined(__GNUC__) || defined(__clang__))
+#define JACKAL_SCAN_X86 1
+#include <immintrin.h>
+#endif
+
+namespace
+{
+namespace char_class = jackal::lexer::char_class;
+
+namespace detail = jackal::lexer::scan::detail;
+using detail::Isa;
+using detail::Scanners;
+
+/// Each run is described by a scalar membership test and, on x86-64, equivalent vector tests
+/// that set every byte lane belonging to the run.
+struct Digits
+{
+  static constexpr bool matches(char c) noexcept { return char_class::is_digit(c); }
+
+#ifdef JACKAL_SCAN_X86
+  static __m128i sse2(__m128i v) noexcept
+  {
+    return _mm_and_si128(_mm_cmpgt_epi8(v, _mm_set1_epi8('0' - 1)),
+                         _mm_cmplt_epi8(v, _mm_set1_epi8('9' + 1)));
+  }
+
+  __attribute__((target("avx2"))) static __m256i avx2(__m256i v) noexcept
+  {
+    return _mm256_and_si256(_mm256_cmpgt_epi8(v, _mm256_set1_epi8('0' - 1)),
+                            _mm256_cmpgt_epi8(_mm256_set1_epi8('9' + 1), v));
+  }
+#endif
+};
+
+struct Lower
+{
+  static constexpr bool matches(char c) noexcept { return char_class::is_lower(c); }
+
+#ifdef JACKAL_SCAN_X86
+  static __m128i sse2(__m128i v) noexcept
+  {
+    return _mm_and_si128(_mm_cmpgt_epi8(v, _mm_set1_epi8('a' - 1)),
+                         _mm_cmplt_epi8(v, _mm_set1_epi8('z' + 1)));
+  }
+
+  __attribute__((target("avx2"))) static __m256i avx2(__m256i v) noexcept
+  {
+    return _mm256_and_si256(_mm256_cmpgt_epi8(v, _mm256_set1_epi8('a' - 1)),
+                            _mm256_cmpgt_epi8(_mm256_set1_epi8('z' + 1), v));
+  }
+#endif
+};
+
+struct Upper
+{
+  static constexpr bool matches(char c) noexcept { return char_class::is(c, char_class::Upper); }
+
+#ifdef JACKAL_SCAN_X86
+  static __m128i sse2(__m128i v) noexcept
+  {
+    return _mm_and_si128(_mm_cmpgt_epi8(v, _mm_set1_epi8('A' - 1)),
+                         _mm_cmplt_epi8(v, _mm_set1_epi8('Z' + 1)));
+  }
+
+  __attribute__((target("avx2"))) static __m256i avx2(__m256i v) noexcept
+  {
+    return _mm256_and_si256(_mm256_cmpgt_epi8(v, _mm256_set1_epi8('A' - 1)),
+                            _mm256_cmpgt_epi8(_mm256_set1_epi8('Z' + 1), v));
+  }
+#endif
+};
+
+struct Underscore
+{
+  static constexpr bool matches(char c) noexcept { return c == '_'; }
+
+#ifdef JACKAL_SCAN_X86
+  static __m128i sse2(__m128i v) noexcept { return _mm_cmpeq_epi8(v, _mm_set1_epi8('_')); }
+
+  __attribute__((target("avx2"))) static __m256i avx2(__m256i v) noexcept
+  {
+    return _mm256_cmpeq_epi8(v, _mm256_set1_epi8('_'));
+  }
+#endif
+};
+
+/// The union of several runs.
+template <typename... Classes>
+struct AnyOf
+{
+  static constexpr bool matches(char c) noexcept { return (Classes::matches(c) || ...); }
+
+#ifdef JACKAL_SCAN_X86
+  static __m128i sse2(__m128i v) noexcept
+  {
+    __m128i mask = _mm_setzero_si128();
+    ((mask = _mm_or_si128(mask, Classes::sse2(v))), ...);
+    return mask;
+  }
+
+  __attribute__((target("avx2"))) static __m256i avx2(__m256i v) noexcept
+  {
+    __m256i mask = _mm256_setzero_si256();
+    ((mask = _mm256_or_si256(mask, Classes::avx2(v))), ...);
+    return mask;
+  }
+#endif
+};
+
+struct StringBody
+{
+  static constexpr bool matches(char c) noexcept { return c != '"' && c != '\0'; }
+
+#ifdef JACKAL_SCAN_X86
+  static __m128i sse2(__m128i v) noexcept
+  {
+    __m128i stop = _mm_or_si128(_mm_cmpeq_epi8(v, _mm_set1_epi8('"')),
+                                _mm_cmpeq_epi8(v, _mm_setzero_si128()));
+    return _mm_xor_si128(stop, _mm_set1_epi8(-1));
+  }
+
+  __attribute__((target("avx2"))) static __m256i avx2(__m256i v) noexcept
+  {
+    __m256i stop = _mm256_or_si256(_mm256_cmpeq_epi8(v, _mm256_set1_epi8('"')),
+                                   _mm256_cmpeq_epi8(v, _mm256_setzero_si256()));
+    return _mm256_xor_si256(stop, _mm256_set1_epi8(-1));
+  }
+#endif
+};
+
+using AlphalowerOrNumber = AnyOf<Lower, Digits>;
+using ValueIdentifier = AnyOf<Lower, Digits, Underscore>;
+using Alphanumeric = AnyOf<Lower, Upper, Digits>;
+
+template <typename Run>
+auto scan_scalar(char const* code) noexcept -> std::size_t
+{
+  char const* it = code;
+  while (Run::matches(*it))
+  {
+    ++it;
+  }
+  return static_cast<std::size_t>(it - code);
+}
+
+#ifdef JACKAL_SCAN_X86
+// Vector scans load aligned blocks beginning at or before the start of the run. Aligned loads
+// cannot cross a page boundary, so no block extends into a page that does not also contain the
+// NUL terminator, which always ends the run.
+
+template <typename Run>
+auto scan_sse2(char const* code) noexcept -> std::size_t
+{
+  constexpr std::size_t Width = 16;
+  auto const address = reinterpret_cast<std::uintptr_t>(code);  // NOLINT
+  auto const offset = address % Width;
+  auto const* block = reinterpret_cast<__m128i const*>(address - offset);  // NOLINT
+
+  uint32_t stops =
+      (~static_cast<uint32_t>(_mm_movemask_epi8(Run::sse2(_mm_load_si128(block)))) & 0xFFFFU) >>
+      offset;
+  if (stops != 0)
+  {
+    return static_cast<std::size_t>(__builtin_ctz(stops));
+  }
+
+  std::size_t length = Width - offset;
+  for (;;)
+  {
+    ++block;  // NOLINT
+    stops = ~static_cast<uint32_t>(_mm_movemask_epi8(Run::sse2(_mm_load_si128(block))));
+    if ((stops & 0xFFFFU) != 0)
+    {
+      return length + static_cast<std::size_t>(__builtin_ctz(stops));
+    }
+    length += Width;
+  }
+}
+
+template <typename Run>
+__attribute__((target("avx2"))) auto scan_avx2(char const* code) noexcept -> std::size_t
+{
+  constexpr std::size_t Width = 32;
+  auto const address = reinterpret_cast<std::uintptr_t>(code);  // NOLINT
+  auto const offset = address % Width;
+  auto const* block = reinterpret_cast<__m256i const*>(address - offset);  // NOLINT
+
+  uint64_t stops =
+      ~static_cast<uint32_t>(_mm256_movemask_epi8(Run::avx2(_mm256_load_si256(block))));
+  stops >>= offset;
+  if (stops != 0)
+  {
+    return static_cast<std::size_t>(__builtin_ctzll(stops));
+  }
+
+  std::size_t length = Width - offset;
+  for (;;)
+  {
+    ++block;  // NOLINT
+    auto const blockStops =
+        ~static_cast<uint32_t>(_mm256_movemask_epi8(Run::avx2(_mm256_load_si256(block))));
+    if (blockStops != 0)
+    {
+      return length + static_cast<std::size_t>(__builtin_ctz(blockStops));
+    }
+    length += Width;
+  }
+}
+#endif
+
+template <template <typename> typename Scan>
+constexpr auto table() noexcept -> Scanners
+{
+  return {Scan<Digits>::run, Scan<AlphalowerOrNumber>::run, Scan<ValueIdentifier>::run,
+          Scan<Alphanumeric>::run, Scan<StringBody>::run};
+}
+
+template <typename Run>
+struct Scalar
+{
+  static auto run(char const* code) noexcept -> std::size_t { return scan_scalar<Run>(code); }
+};
+
+#ifdef JACKAL_SCAN_X86
+template <typename Run>
+struct Sse2
+{
+  static auto run(char const* code) noexcept -> std::size_t { return scan_sse2<Run>(code); }
+};
+
+template <typename Run>
+struct Avx2
+{
+  static auto run(char const* code) noexcept -> std::size_t { return scan_avx2<Run>(code); }
+};
+#endif
+
+auto active() noexcept -> Scanners&
+{
+  static Scanners scanners = *detail::scanners(detail::best());
+  return scanners;
+}
+}  // namespace
+
+auto jackal::lexer::scan::digits(char const* code) noexcept -> std::size_t
+{
+  return active().digits(code);
+}
+
+auto jackal::lexer::scan::alphalower_or_number(char const* code) noexcept -> std::size_t
+{
+  return active().alphalowerOrNumber(code);
+}
+
+auto jackal::lexer::scan::value_identifier(char const* code) noexcept -> std::size_t
+{
+  return active().valueIdentifier(code);
+}
+
+auto jackal::lexer::scan::alphanumeric(char const* code) noexcept -> std::size_t
+{
+  return active().alphanumeric(code);
+}
+
+auto jackal::lexer::scan::string_body(char const* code) noexcept -> std::size_t
+{
+  return active().stringBody(code);
+}
+
+auto jackal::lexer::scan::detail::name(Isa isa) noexcept -> std::string_view
+{
+  switch (isa)
+  {
+    case Isa::Scalar:
+      return "scalar";
+    case Isa::Sse2:
+      return "sse2";
+    case Isa::Avx2:
+      return "avx2";
+  }
+  return "unknown";
+}
+
+auto jackal::lexer::scan::detail::scanners(Isa isa) noexcept -> std::optional<Scanners>
+{
+  switch (isa)
+  {
+    case Isa::Scalar:
+      return table<Scalar>();
+#ifdef JACKAL_SCAN_X86
+    case Isa::Sse2:
+      return table<Sse2>();
+    case Isa::Avx2:
+      __builtin_cpu_init();
+      if (__builtin_cpu_supports("avx2"))
+      {
+        return table<Avx2>();
+      }
+      return std::nullopt;
+#endif
+    default:
+      return std::nullopt;
+  }
+}
+
+auto jackal::lexer::scan::detail::best() noexcept -> Isa
+{
+  for (auto isa : {Isa::Avx2, Isa::Sse2})
+  {
+    if (scanners(isa).has_value())
+    {
+      return isa;
+    }
+  }
+  return Isa::Scalar;
+}
+
+auto jackal::lexer::scan::detail::select(Isa isa) noexcept -> bool
+{
+  auto chosen = scanners(isa);
+  if (!chosen.has_value())
+  {
+    return false;
+  }
+
+  active() = *chosen;
+  return true;
+}
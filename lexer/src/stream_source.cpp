@@ -0,0 +1,84 @@
+#include "lexer/stream_source.hpp"
+
+#include <unistd.h>
+
+#include <cassert>
+#include <cerrno>
+#include <cstring>
+#include <utility>
+
+using jackal::lexer::StreamSource;
+
+StreamSource::StreamSource(int fd, std::size_t chunkSize, std::size_t maxRetained) noexcept
+    : _fd(fd), _chunkSize(chunkSize), _maxRetained(maxRetained)
+{
+  assert(chunkSize > 0);
+  _buffers.push_back(allocate());
+  read_chunk();
+}
+
+auto StreamSource::refill(char const* keep) noexcept -> char const*
+{
+  assert(keep >= data() && keep <= end());
+  auto retained = static_cast<std::size_t>(end() - keep);
+  assert(retained <= max_retained());
+
+  auto buffer = allocate();
+  std::memcpy(buffer.get(), keep, retained);
+  _buffers.push_back(std::move(buffer));
+  _size = retained;
+  ++_generation;
+
+  read_chunk();
+  return data();
+}
+
+auto StreamSource::release(uint64_t generation) noexcept -> void
+{
+  auto oldest = _generation + 1 - _buffers.size();
+  for (; oldest < generation && _buffers.size() > 1; ++oldest)
+  {
+    // A single buffer is kept for reuse, which is all that steady-state lexing needs
+    if (_spare.empty())
+    {
+      _spare.push_back(std::move(_buffers.front()));
+    }
+    _buffers.pop_front();
+  }
+}
+
+auto StreamSource::allocate() noexcept -> Buffer
+{
+  if (!_spare.empty())
+  {
+    auto buffer = std::move(_spare.back());
+    _spare.pop_back();
+    return buffer;
+  }
+
+  // Room for the largest carried-over content followed by a full chunk
+  return std::make_unique_for_overwrite<char[]>(_maxRetained + _chunkSize + Padding);  // NOLINT
+}
+
+auto StreamSource::read_chunk() noexcept -> void
+{
+  // Pipes may return less than a full chunk; any amount of new input is enough to make progress
+  while (!_exhausted)
+  {
+    auto count = ::read(_fd, _buffers.back().get() + _size, _chunkSize);
+    if (count > 0)
+    {
+      _size += static_cast<std::size_t>(count);
+      break;
+    }
+    if (count < 0 && errno == EINTR)
+    {
+      continue;
+    }
+
+    _failed = count < 0;
+    _exhausted = true;
+  }
+
+  std::memset(_buffers.back().get() + _size, '\0', Padding);
+}
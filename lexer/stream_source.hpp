@@ -0,0 +1,85 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <memory>
+#include <vector>
+
+namespace jackal::lexer
+{
+/// @brief Incrementally reads source code from a file descriptor into bounded buffers.
+///
+/// StreamSource allows the Lexer to operate on input that is never fully resident in memory, such
+/// as generated code piped into the compiler. Every buffer ends with NUL padding so that it can be
+/// lexed in the same way as an in-memory source.
+///
+/// Each refill reads into a new buffer that begins with a copy of the unfinished content of the
+/// previous one. Buffers never move or grow, so pointers into a buffer remain valid until it is
+/// released, and the size of a buffer does not depend on how long the lines of the input are.
+struct StreamSource
+{
+  static constexpr std::size_t DefaultChunkSize = 64 * 1024;
+  static constexpr std::size_t DefaultMaxRetained = 64 * 1024;
+
+  /// @brief Constructs a StreamSource and reads the first chunk of input.
+  ///
+  /// The file descriptor is not owned by the StreamSource and must remain open for its lifetime.
+  ///
+  /// @param fd the file descriptor to read from
+  /// @param chunkSize the number of bytes to request from @p fd for each refill
+  /// @param maxRetained the most content that a refill can carry over into the next buffer
+  explicit StreamSource(int fd, std::size_t chunkSize = DefaultChunkSize,
+                        std::size_t maxRetained = DefaultMaxRetained) noexcept;
+
+  /// @returns the beginning of the current buffer
+  [[nodiscard]] char const* data() const noexcept { return _buffers.back().get(); }
+
+  /// @returns the end of the content within the current buffer, which always points at NUL padding
+  [[nodiscard]] char const* end() const noexcept { return data() + _size; }
+
+  /// @returns whether the current buffer contains the end of the input
+  [[nodiscard]] bool exhausted() const noexcept { return _exhausted; }
+
+  /// @returns whether reading from the file descriptor failed; failure also exhausts the input
+  [[nodiscard]] bool failed() const noexcept { return _failed; }
+
+  /// @returns the most content that a refill can carry over from the current buffer
+  [[nodiscard]] std::size_t max_retained() const noexcept { return _maxRetained; }
+
+  /// @returns the sequence number of the current buffer, which each refill increments
+  [[nodiscard]] uint64_t generation() const noexcept { return _generation; }
+
+  /// @returns the number of buffers that have not yet been released
+  [[nodiscard]] std::size_t buffers() const noexcept { return _buffers.size(); }
+
+  /// @brief Starts a new buffer with the content from @p keep onwards and reads the next chunk.
+  ///
+  /// The previous buffers are left untouched until they are released.
+  ///
+  /// @param keep a position within the current buffer at most max_retained bytes before its end
+  /// @returns the new location of @p keep
+  char const* refill(char const* keep) noexcept;
+
+  /// @brief Frees every buffer older than @p generation; the current buffer is never freed.
+  void release(uint64_t generation) noexcept;
+
+ private:
+  static constexpr std::size_t Padding = 4;
+
+  using Buffer = std::unique_ptr<char[]>;  // NOLINT
+
+  Buffer allocate() noexcept;
+  void read_chunk() noexcept;
+
+  int _fd;
+  std::size_t _chunkSize;
+  std::size_t _maxRetained;
+  std::deque<Buffer> _buffers;
+  std::vector<Buffer> _spare;
+  std::size_t _size = 0;
+  uint64_t _generation = 0;
+  bool _exhausted = false;
+  bool _failed = false;
+};
+}  // namespace jackal::lexer
@@ -0,0 +1,31 @@
+#include "tests/catch.hpp"
+
+#include "lexer/keywords.hpp"
+#include "util/keywords.hpp"
+
+using jackal::lexer::keywords::Classification;
+using jackal::lexer::keywords::classify;
+
+TEST_CASE("Every keyword should classify as a keyword", "[lexer][keywords]")
+{
+  for (auto keyword : jackal::util::keyword::AllKeywords)
+  {
+    REQUIRE(classify(keyword) == Classification::Keyword);
+  }
+}
+
+TEST_CASE("Boolean literals should classify as booleans", "[lexer][keywords]")
+{
+  REQUIRE(classify("true") == Classification::Boolean);
+  REQUIRE(classify("false") == Classification::Boolean);
+}
+
+TEST_CASE("Words resembling reserved words should classify as identifiers", "[lexer][keywords]")
+{
+  REQUIRE(classify("le") == Classification::Identifier);
+  REQUIRE(classify("lets") == Classification::Identifier);
+  REQUIRE(classify("fun") == Classification::Identifier);
+  REQUIRE(classify("truefalse") == Classification::Identifier);
+  REQUIRE(classify("interpreted") == Classification::Identifier);
+  REQUIRE(classify("x") == Classification::Identifier);
+}
@@ -52,6 +52,14 @@ TEST_CASE("Equal should lex", "[lexer][lexer_token]")
   require_next(lexer, Token::Kind::Equal, "=");
 }
 
+TEST_CASE("Plus should lex", "[lexer][lexer_token]")
+{
+  auto const* code = "+";
+  Lexer lexer(code);
+
+  require_next(lexer, Token::Kind::Plus, "+");
+}
+
 TEST_CASE("Single integer should lex", "[lexer][lexer_token]")
 {
   auto const* code = "12190";
@@ -68,6 +76,14 @@ TEST_CASE("Single floating-point value should lex", "[lexer][lexer_token]")
   require_next(lexer, Token::Kind::Number, "12190.123");
 }
 
+TEST_CASE("Floating-point value with single fractional digit should lex", "[lexer][lexer_token]")
+{
+  auto const* code = "1.5 ";
+  Lexer lexer(code);
+
+  require_next(lexer, Token::Kind::Number, "1.5");
+}
+
 TEST_CASE("Invalid floating-point value should not lex", "[lexer][lexer_token]")
 {
   auto const* code = "12190. ";
@@ -100,6 +116,15 @@ TEST_CASE("Multi-line string should lex", "[lexer][lexer_token]")
   require_next(lexer, Token::Kind::String, "\"this string\nspans multiple\nlines\"");
 }
 
+TEST_CASE("Unterminated string should not lex", "[lexer][lexer_token]")
+{
+  auto const* code = "\"no end in sight";
+  Lexer lexer(code);
+
+  REQUIRE(lexer.peek_token<1>().kind() == Token::Kind::Halt);
+  require_next(lexer, Token::Kind::Unknown, "\"no end in sight");
+}
+
 TEST_CASE("Boolean with true value should lex", "[lexer][lexer_token]")
 {
   auto const* code = "true";
@@ -376,3 +401,43 @@ TEST_CASE("Lexed tokens should have correct source locations",  // NOLINT
   REQUIRE(lexer.peek_token<3>().location().column() == 8);
   REQUIRE(lexer.peek_token<0>().location().line().src() == "let y = 456");
 }
+
+TEST_CASE("Lexer should recover previously lexed lines by number", "[lexer][source_location]")
+{
+  auto const* code = "let x = 123\nlet y = 456\nprint y";
+  Lexer lexer(code);
+
+  while (!lexer.is_halted())
+  {
+    lexer.next();
+  }
+  REQUIRE(lexer.line(0).src() == "let x = 123");
+  REQUIRE(lexer.line(1).src() == "let y = 456");
+  REQUIRE(lexer.line(2).src() == "print y");
+  REQUIRE(lexer.line(2).num() == 2);
+}
+
+TEST_CASE("Lexer should intern identifiers when given an Interner", "[lexer][interner]")
+{
+  jackal::util::Interner interner;
+  Lexer lexer("let x = Foo\nprint x\n", interner);
+
+  REQUIRE_FALSE(lexer.next().symbol().has_value());  // let
+  auto x = lexer.next();
+  REQUIRE(x.symbol().has_value());
+  REQUIRE(interner.name(*x.symbol()) == "x");
+  lexer.next();  // =
+  auto type = lexer.next();
+  REQUIRE(type.kind() == Token::Kind::TypeIdentifier);
+  REQUIRE(interner.name(*type.symbol()) == "Foo");
+  lexer.next();  // \n
+  REQUIRE(interner.name(*lexer.next().symbol()) == "print");
+  REQUIRE(lexer.next().symbol() == x.symbol());
+  REQUIRE(interner.size() == 3);
+}
+
+TEST_CASE("Lexer should not intern identifiers without an Interner", "[lexer][interner]")
+{
+  Lexer lexer("x");
+  REQUIRE_FALSE(lexer.next().symbol().has_value());
+}
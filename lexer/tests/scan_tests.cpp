@@ -0,0 +1,136 @@
+#include "tests/catch.hpp"
+
+#include <cstddef>
+#include <string>
+
+#include "lexer/char_class.hpp"
+#include "lexer/scan.hpp"
+
+namespace scan = jackal::lexer::scan;
+namespace char_class = jackal::lexer::char_class;
+
+using jackal::lexer::scan::detail::Isa;
+using jackal::lexer::scan::detail::Scanners;
+
+namespace
+{
+// Places a run of @p length characters followed by @p stop at every alignment within a vector
+// block, ensuring that runs are found correctly regardless of where blocks begin and end.
+template <typename Scan>
+void require_runs(Scan scanner, char member, char stop)
+{
+  constexpr std::size_t MaxOffset = 64;
+  constexpr std::size_t MaxLength = 100;
+  for (std::size_t offset = 0; offset < MaxOffset; ++offset)
+  {
+    for (std::size_t length = 0; length < MaxLength; ++length)
+    {
+      std::string buffer(offset, stop);
+      buffer.append(length, member);
+      buffer.push_back(stop);
+      buffer.append(MaxOffset, member);
+      REQUIRE(scanner(buffer.c_str() + offset) == length);
+    }
+  }
+}
+
+// Runs @p check against the scanners of every instruction set, skipping those that this build or
+// processor does not support. The public scan functions only ever reach the fastest of them.
+template <typename Check>
+void for_each_isa(Check check)
+{
+  for (auto isa : {Isa::Scalar, Isa::Sse2, Isa::Avx2})
+  {
+    auto scanners = scan::detail::scanners(isa);
+    if (!scanners.has_value())
+    {
+      WARN("Skipping unsupported " << scan::detail::name(isa) << " scanners");
+      continue;
+    }
+
+    INFO("Scanning with " << scan::detail::name(isa));
+    check(*scanners);
+  }
+}
+}  // namespace
+
+TEST_CASE("Character class table should classify ASCII characters", "[lexer][char_class]")
+{
+  REQUIRE(char_class::is_digit('0'));
+  REQUIRE(char_class::is_digit('9'));
+  REQUIRE_FALSE(char_class::is_digit('a'));
+  REQUIRE(char_class::is_lower('q'));
+  REQUIRE_FALSE(char_class::is_lower('Q'));
+  REQUIRE(char_class::is_alpha('Q'));
+  REQUIRE_FALSE(char_class::is_alpha('_'));
+  REQUIRE_FALSE(char_class::is_alpha('\xE9'));
+}
+
+TEST_CASE("Digit runs should be found at any alignment", "[lexer][scan]")
+{
+  for_each_isa(
+      [](Scanners const& scanners)
+      {
+        require_runs(scanners.digits, '7', ' ');
+        require_runs(scanners.digits, '0', '.');
+      });
+}
+
+TEST_CASE("Alphalower runs should be found at any alignment", "[lexer][scan]")
+{
+  for_each_isa(
+      [](Scanners const& scanners)
+      {
+        require_runs(scanners.alphalowerOrNumber, 'z', '_');
+        require_runs(scanners.alphalowerOrNumber, '3', 'A');
+      });
+}
+
+TEST_CASE("Value identifier runs should be found at any alignment", "[lexer][scan]")
+{
+  for_each_isa(
+      [](Scanners const& scanners)
+      {
+        require_runs(scanners.valueIdentifier, '_', '(');
+        require_runs(scanners.valueIdentifier, 'a', '\n');
+      });
+}
+
+TEST_CASE("Alphanumeric runs should be found at any alignment", "[lexer][scan]")
+{
+  for_each_isa(
+      [](Scanners const& scanners)
+      {
+        require_runs(scanners.alphanumeric, 'Z', '[');
+        require_runs(scanners.alphanumeric, 'a', '@');
+      });
+}
+
+TEST_CASE("String body runs should be found at any alignment", "[lexer][scan]")
+{
+  for_each_isa(
+      [](Scanners const& scanners)
+      {
+        require_runs(scanners.stringBody, ' ', '"');
+        require_runs(scanners.stringBody, '\n', '"');
+      });
+}
+
+TEST_CASE("Scanners should be selectable at run time", "[lexer][scan]")
+{
+  REQUIRE(scan::detail::scanners(Isa::Scalar).has_value());
+  REQUIRE(scan::detail::scanners(scan::detail::best()).has_value());
+
+  REQUIRE(scan::detail::select(Isa::Scalar));
+  REQUIRE(scan::digits("12345 ") == 5);
+  REQUIRE(scan::detail::select(scan::detail::best()));
+}
+
+TEST_CASE("Runs should stop at the end of the source", "[lexer][scan]")
+{
+  REQUIRE(scan::digits("12345") == 5);
+  REQUIRE(scan::alphalower_or_number("abc123") == 6);
+  REQUIRE(scan::value_identifier("snake_case") == 10);
+  REQUIRE(scan::alphanumeric("Sha256") == 6);
+  REQUIRE(scan::string_body("unterminated") == 12);
+}
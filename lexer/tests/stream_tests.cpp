@@ -0,0 +1,207 @@
+#include "tests/catch.hpp"
+
+#include <unistd.h>
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+#include "lexer/lexer.hpp"
+#include "lexer/stream_source.hpp"
+#include "lexer/token.hpp"
+#include "tests/resource.hpp"
+
+using jackal::lexer::Lexer;
+using jackal::lexer::StreamSource;
+using jackal::lexer::Token;
+
+namespace
+{
+struct Lexed
+{
+  Token::Kind kind;
+  std::string lexeme;
+  uint64_t lineNum;
+  uint64_t column;
+
+  bool operator==(Lexed const&) const = default;
+};
+
+auto lexed(Token const& token) -> Lexed
+{
+  return {token.kind(), token.lexeme_str(), token.location().line().num(),
+          token.location().column()};
+}
+
+// Alternates lookahead and consumption so that buffered tokens must survive refills
+auto lex_all(Lexer& lexer) -> std::vector<Lexed>
+{
+  std::vector<Lexed> tokens;
+  while (!lexer.is_halted())
+  {
+    auto peeked = lexed(lexer.peek_token<0>());
+    static_cast<void>(lexer.peek_token<2>());
+    auto token = lexed(lexer.next());
+    REQUIRE(token == peeked);
+    tokens.push_back(token);
+  }
+  return tokens;
+}
+
+// Pipes are used so that reads may return less than a full chunk; the code must fit in the pipe
+auto piped(std::string_view code) -> int
+{
+  std::array<int, 2> fds{};
+  REQUIRE(::pipe(fds.data()) == 0);
+  REQUIRE(::write(fds[1], code.data(), code.size()) == static_cast<ssize_t>(code.size()));
+  ::close(fds[1]);
+  return fds[0];
+}
+
+auto lex_streamed(std::string_view code, std::size_t chunkSize) -> std::vector<Lexed>
+{
+  int fd = piped(code);
+  StreamSource source(fd, chunkSize);
+  Lexer lexer(source);
+  auto tokens = lex_all(lexer);
+  REQUIRE_FALSE(source.failed());
+  ::close(fd);
+  return tokens;
+}
+
+void require_streamed_matches_buffered(std::string const& code)
+{
+  Lexer lexer(code.c_str());
+  auto expected = lex_all(lexer);
+  for (std::size_t chunkSize : {1, 2, 3, 5, 8, 13, 4096})
+  {
+    INFO("chunk size " << chunkSize);
+    REQUIRE(lex_streamed(code, chunkSize) == expected);
+  }
+}
+}  // namespace
+
+TEST_CASE("Streamed lexing should match in-memory lexing", "[lexer][stream]")
+{
+  jackal::tests::FileTestResource main("lexer_main.jkl");
+  require_streamed_matches_buffered(std::string(main.content()));
+}
+
+TEST_CASE("Streamed lexing should handle tokens longer than a chunk", "[lexer][stream]")
+{
+  require_streamed_matches_buffered(
+      "let some_very_long_identifier_name = 1234567890.0987654321\n"
+      "print \"a string literal that is\nmuch longer than any chunk\"\n"
+      "let x = 'c' :: -> :::\n");
+}
+
+TEST_CASE("Streamed lexing of empty input should halt", "[lexer][stream]")
+{
+  REQUIRE(lex_streamed("", 4).empty());
+}
+
+TEST_CASE("Streamed identifiers should keep their symbols across refills", "[lexer][stream]")
+{
+  int fd = piped("let alpha = beta\nprint alpha + gamma_delta\n");
+  jackal::util::Interner interner;
+  StreamSource source(fd, 1);
+  Lexer lexer(source, interner);
+  std::vector<std::string> identifiers;
+  while (!lexer.is_halted())
+  {
+    static_cast<void>(lexer.peek_token<2>());
+    auto token = lexer.next();
+    if (token.kind() == Token::Kind::ValueIdentifier)
+    {
+      REQUIRE(token.symbol().has_value());
+      identifiers.emplace_back(interner.name(*token.symbol()));
+    }
+  }
+  ::close(fd);
+
+  REQUIRE(identifiers ==
+          std::vector<std::string>{"alpha", "beta", "print", "alpha", "gamma_delta"});
+  REQUIRE(interner.size() == 4);
+}
+
+TEST_CASE("Streamed lexing of a long line should keep a bounded window", "[lexer][stream]")
+{
+  std::string code = "print x";
+  while (code.size() < 48 * 1024)
+  {
+    code += " + some_identifier + 12345";
+  }
+  code += "\n";
+
+  Lexer buffered(code.c_str());
+  auto expected = lex_all(buffered);
+
+  int fd = piped(code);
+  StreamSource source(fd, 64, 256);
+  Lexer lexer(source);
+  std::vector<Lexed> tokens;
+  std::size_t buffers = 0;
+  while (!lexer.is_halted())
+  {
+    static_cast<void>(lexer.peek_token<Lexer::MAX_LOOKAHEAD - 1>());
+    tokens.push_back(lexed(lexer.next()));
+    buffers = std::max(buffers, source.buffers());
+  }
+  ::close(fd);
+
+  REQUIRE(tokens == expected);
+  REQUIRE(buffers <= Lexer::PinnedTokens + Lexer::MAX_LOOKAHEAD + 1);
+}
+
+TEST_CASE("Streamed lexemes should remain valid while pinned", "[lexer][stream]")
+{
+  int fd = piped("let first = 1234567\nprint first + \"text\" + 2.5\nlet second = first\n");
+  StreamSource source(fd, 1);
+  Lexer lexer(source);
+
+  // Lookahead is interleaved so that tokens are lexed from many different buffers
+  std::vector<std::pair<Token, Lexed>> pinned;
+  while (!lexer.is_halted())
+  {
+    static_cast<void>(lexer.peek_token<1>());
+    auto token = lexer.next();
+    pinned.emplace_back(token, lexed(token));
+    if (pinned.size() > Lexer::PinnedTokens + 1)
+    {
+      pinned.erase(pinned.begin());
+    }
+
+    for (auto const& [kept, copy] : pinned)
+    {
+      REQUIRE(lexed(kept) == copy);
+    }
+  }
+  ::close(fd);
+}
+
+TEST_CASE("Streamed tokens longer than the window should be split", "[lexer][stream]")
+{
+  std::string identifier(100, 'a');
+  int fd = piped("let " + identifier + " = 1\n");
+  StreamSource source(fd, 8, 32);
+  Lexer lexer(source);
+
+  REQUIRE(lexer.next().kind() == Token::Kind::Keyword);
+  auto piece = lexer.next();
+  REQUIRE(piece.kind() == Token::Kind::Unknown);
+  REQUIRE(piece.lexeme().size() <= 32 + 8);
+
+  std::string pieces(piece.lexeme());
+  for (auto token = lexer.next(); token.kind() != Token::Kind::Equal; token = lexer.next())
+  {
+    pieces += token.lexeme();
+  }
+  ::close(fd);
+
+  REQUIRE(pieces == identifier);
+}
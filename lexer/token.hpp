@@ -1,9 +1,12 @@
 #pragma once
 
 #include <cstddef>
+#include <cstdint>
+#include <optional>
 #include <string>
 #include <string_view>
 
+#include "util/interner.hpp"
 #include "util/source_location.hpp"
 
 namespace jackal::lexer
@@ -36,6 +39,8 @@ struct Token
     End,
     // =
     Equal,
+    // +
+    Plus,
     // .
     Dot,
     // ,
@@ -78,10 +83,28 @@ struct Token
 
   [[nodiscard]] std::string lexeme_str() const noexcept { return std::string(_lexeme); }
 
+  /// @returns the interned lexeme of an identifier, or std::nullopt if the lexeme was not interned
+  [[nodiscard]] constexpr std::optional<util::Symbol> symbol() const noexcept
+  {
+    return _symbol != NoSymbol ? std::optional(util::Symbol(_symbol)) : std::nullopt;
+  }
+
+  /// @returns a copy of this Token whose lexeme has been interned as @p symbol
+  [[nodiscard]] constexpr Token interned(util::Symbol symbol) const noexcept
+  {
+    Token token = *this;
+    token._symbol = symbol.id();
+    return token;
+  }
+
   auto operator<=>(Token const&) const noexcept = default;
 
  private:
+  static constexpr uint32_t NoSymbol = UINT32_MAX;
+
   Kind _kind;
+  // Stored unwrapped so that it occupies the padding after _kind
+  uint32_t _symbol = NoSymbol;
   util::SourceLocation _location;
   std::string_view _lexeme;
 };
@@ -0,0 +1,83 @@
+/// @file Measures how the parser scales with the length of an expression.
+///
+/// Usage: jackal_parser_benchmark
+///
+/// Parses programs made of a single `print x + x + ... + x` whose chain of additions grows by a
+/// factor of ten at each step, into both the node tree and the flat encoding. Expressions are
+/// parsed without recursion, so the time per term should stay flat as the chain grows.
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <iostream>
+#include <string>
+#include <string_view>
+
+#include "ast/arena.hpp"
+#include "ast/flat_tree.hpp"
+#include "ast/include.hpp"
+#include "parser/include.hpp"
+#include "parser/parse.hpp"
+#include "util/interner.hpp"
+
+using jackal::parser::Parser;
+
+namespace
+{
+constexpr std::size_t MinTerms = 1000;
+constexpr std::size_t MaxTerms = 1000000;
+
+auto chain(std::size_t terms) -> std::string
+{
+  std::string code = "print x";
+  code.reserve(code.size() + terms * 4 + 1);
+  for (std::size_t i = 1; i < terms; ++i)
+  {
+    code += " + x";
+  }
+  code += "\n";
+  return code;
+}
+
+auto parse_nodes(char const* code) -> bool
+{
+  jackal::ast::Arena arena;
+  jackal::util::Interner interner;
+  Parser parser(arena, interner, code);
+  return parser.parse_program().is_ok();
+}
+
+auto parse_flat(char const* code) -> bool
+{
+  jackal::ast::Arena arena;
+  jackal::util::Interner interner;
+  Parser parser(arena, interner, code);
+  return parser.parse_flat_program().is_ok();
+}
+
+template <typename Workload>
+void measure(std::string_view name, std::size_t terms, Workload workload)
+{
+  auto code = chain(terms);
+  auto start = std::chrono::steady_clock::now();
+  auto ok = workload(code.c_str());
+  std::chrono::duration<double, std::nano> elapsed = std::chrono::steady_clock::now() - start;
+
+  std::cout << name << " " << terms << " terms: ";
+  if (!ok)
+  {
+    std::cout << "failed to parse" << std::endl;
+    return;
+  }
+  std::cout << static_cast<uint64_t>(elapsed.count() / 1e3) << " us, "
+            << elapsed.count() / static_cast<double>(terms) << " ns/term" << std::endl;
+}
+}  // namespace
+
+auto main() -> int
+{
+  for (auto terms = MinTerms; terms <= MaxTerms; terms *= 10)
+  {
+    measure("nodes", terms, parse_nodes);
+    measure("flat", terms, parse_flat);
+  }
+}
@@ -0,0 +1,14 @@
+#pragma once
+
+#include <string_view>
+
+#include "util/keywords.hpp"
+
+namespace jackal::parser::keyword
+{
+/// @brief Begins a binding instruction; lexed as a Keyword.
+constexpr std::string_view kLet = util::keyword::Let;
+
+/// @brief Begins a print instruction. It is not reserved, so it is lexed as a ValueIdentifier.
+constexpr std::string_view kPrint = "print";
+}  // namespace jackal::parser::keyword
@@ -2,35 +2,63 @@
 
 #include <optional>
 
+#include "ast/flat_tree.hpp"
 #include "lexer/lexer.hpp"
+#include "lexer/stream_source.hpp"
 #include "lexer/token.hpp"
 
 // clang-format off
+namespace jackal::ast { struct Arena; }
 namespace jackal::ast { struct Expression; }
 namespace jackal::ast { struct Instruction; }
 namespace jackal::ast { struct Program; }
 namespace jackal::ast { struct Value; }
 namespace jackal::parser { struct ParseError; }
 namespace jackal::util { template<typename, typename> struct Result; }
+namespace jackal::util { struct Interner; }
 // clang-format on
 
 namespace jackal::parser
 {
 struct Parser
 {
-  explicit Parser(const char *code) noexcept : _lexer(code) {}
+  /// @param arena the Arena that will own every node of the parsed syntax tree; must outlive it
+  /// @param interner the Interner that identifiers are resolved against; must outlive the tree
+  /// @param code the NUL-terminated source code to parse
+  Parser(ast::Arena &arena, util::Interner &interner, const char *code) noexcept
+      : _arena(arena), _lexer(code, interner)
+  {
+  }
+
+  /// @brief Constructs a Parser that reads its source code incrementally from @p source.
+  ///
+  /// @param source the input to parse, which must outlive the Parser
+  Parser(ast::Arena &arena, util::Interner &interner, lexer::StreamSource &source) noexcept
+      : _arena(arena), _lexer(source, interner)
+  {
+  }
 
   [[nodiscard]] util::Result<ast::Program, ParseError> parse_program() noexcept;
   [[nodiscard]] util::Result<ast::Instruction, ParseError> parse_instruction() noexcept;
   [[nodiscard]] util::Result<ast::Expression, ParseError> parse_expression() noexcept;
   [[nodiscard]] util::Result<ast::Value, ParseError> parse_value() noexcept;
 
+  /// @brief Parses a program directly into its flat encoding, bypassing the node objects.
+  [[nodiscard]] util::Result<ast::FlatTree, ParseError> parse_flat_program() noexcept;
+  [[nodiscard]] util::Result<ast::FlatTree::NodeId, ParseError> parse_flat_instruction(
+      ast::FlatTree &tree) noexcept;
+  [[nodiscard]] util::Result<ast::FlatTree::NodeId, ParseError> parse_flat_expression(
+      ast::FlatTree &tree) noexcept;
+  [[nodiscard]] util::Result<ast::FlatTree::NodeId, ParseError> parse_flat_value(
+      ast::FlatTree &tree) noexcept;
+
  private:
   [[nodiscard]] util::Result<lexer::Token, ParseError> expect(lexer::Token::Kind kind) noexcept;
   template <std::size_t N>
   [[nodiscard]] std::optional<lexer::Token> attempt(lexer::Token::Kind kind) noexcept;
 
  private:
+  ast::Arena &_arena;
   lexer::Lexer _lexer;
 };
 }  // namespace jackal::parser
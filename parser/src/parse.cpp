@@ -5,7 +5,12 @@
 #include <cstdint>
 #include <functional>
 #include <optional>
+#include <string_view>
+#include <type_traits>
+#include <variant>
+#include <vector>
 
+#include "ast/flat_tree.hpp"
 #include "ast/include.hpp"
 #include "ast/visitor.hpp"
 #include "parser/include.hpp"
@@ -19,6 +24,8 @@ using InstructionResult =
 using ExpressionResult = jackal::util::Result<jackal::ast::Expression, jackal::parser::ParseError>;
 using ValueResult = jackal::util::Result<jackal::ast::Value, jackal::parser::ParseError>;
 using TokenResult = jackal::util::Result<jackal::lexer::Token, jackal::parser::ParseError>;
+using FlatTreeResult = jackal::util::Result<jackal::ast::FlatTree, jackal::parser::ParseError>;
+using NodeResult = jackal::util::Result<jackal::ast::FlatTree::NodeId, jackal::parser::ParseError>;
 
 static std::function<void(jackal::ast::Program&, jackal::ast::Instruction)> const program_subsumer =
     [](jackal::ast::Program& program, jackal::ast::Instruction instruction)
@@ -26,6 +33,55 @@ static std::function<void(jackal::ast::Program&, jackal::ast::Instruction)> cons
   program.add_instruction(std::move(instruction));
 };
 
+/// @brief Converts the lexeme of a Number token into its integer or floating point value.
+static auto number_literal(std::string_view lexeme) noexcept -> std::variant<int64_t, double>
+{
+  if (lexeme.find('.') == std::string_view::npos)
+  {
+    int64_t val = 0;
+    auto [ptr, _] = std::from_chars(lexeme.data(), lexeme.data() + lexeme.size(), val);
+    assert(ptr == lexeme.data() + lexeme.size());
+    return val;
+  }
+
+  double val = NAN;
+  auto [ptr, _] = std::from_chars(lexeme.data(), lexeme.data() + lexeme.size(), val);
+  assert(ptr == lexeme.data() + lexeme.size());
+  return val;
+}
+
+namespace
+{
+/// @brief A binary operator and how tightly it binds its operands.
+///
+/// Operators with a higher precedence are applied before those with a lower one. Every operator
+/// is left associative.
+struct BinaryOperator
+{
+  jackal::ast::Operator::Type type;
+  int precedence;
+};
+
+/// @returns the binary operator spelled by @p token, or std::nullopt if it does not spell one
+auto binary_operator(jackal::lexer::Token const& token) noexcept -> std::optional<BinaryOperator>
+{
+  switch (token.kind())
+  {
+    case jackal::lexer::Token::Kind::Plus:
+      return BinaryOperator{jackal::ast::Operator::Type::Add, 1};
+    default:
+      return std::nullopt;
+  }
+}
+
+/// @returns whether @p token is @p word lexed as a token of kind @p kind
+auto is_word(jackal::lexer::Token const& token, jackal::lexer::Token::Kind kind,
+             std::string_view word) noexcept -> bool
+{
+  return token.kind() == kind && token.lexeme() == word;
+}
+}  // namespace
+
 auto Parser::expect(lexer::Token::Kind kind) noexcept -> TokenResult
 {
   auto token = _lexer.next();
@@ -46,7 +102,7 @@ auto Parser::attempt(lexer::Token::Kind kind) noexcept -> std::optional<lexer::T
 
 auto Parser::parse_program() noexcept -> ProgramResult
 {
-  auto result = ProgramResult::ok_default();
+  auto result = ProgramResult::from(ast::Program(_arena));
   while (!_lexer.is_halted())
   {
     result.consume(program_subsumer, parse_instruction());
@@ -57,21 +113,17 @@ auto Parser::parse_program() noexcept -> ProgramResult
 
 auto Parser::parse_instruction() noexcept -> InstructionResult
 {
-  auto identifier = expect(lexer::Token::Kind::Identifier);
-  if (identifier.is_err())
-  {
-    return InstructionResult::from(identifier.err());
-  }
+  auto head = _lexer.next();
 
-  ast::Instruction::Builder instructionBuilder;
-  if (identifier->lexeme() == keyword::kLet)
+  ast::Instruction::Builder instructionBuilder(_arena);
+  if (is_word(head, lexer::Token::Kind::Keyword, keyword::kLet))
   {
-    auto variable = expect(lexer::Token::Kind::Identifier);
+    auto variable = expect(lexer::Token::Kind::ValueIdentifier);
     if (variable.is_err())
     {
       return InstructionResult::from(variable.err());
     }
-    instructionBuilder.binding.set_variable(variable->lexeme());
+    instructionBuilder.binding.set_variable(*variable->symbol());
 
     auto equals = expect(lexer::Token::Kind::Equal);
     if (equals.is_err())
@@ -86,7 +138,7 @@ auto Parser::parse_instruction() noexcept -> InstructionResult
     }
     instructionBuilder.binding.set_expression(expression.consume_ok());
   }
-  else if (identifier->lexeme() == keyword::kPrint)
+  else if (is_word(head, lexer::Token::Kind::ValueIdentifier, keyword::kPrint))
   {
     auto expression = parse_expression();
     if (expression.is_err())
@@ -98,7 +150,7 @@ auto Parser::parse_instruction() noexcept -> InstructionResult
   else
   {
     return InstructionResult::from(
-        ParseError::invalid_instruction(identifier.ok(), "must begin with 'let' or 'print'\n"));
+        ParseError::invalid_instruction(head, "must begin with 'let' or 'print'\n"));
   }
 
   auto newline = expect(lexer::Token::Kind::Newline);
@@ -112,65 +164,78 @@ auto Parser::parse_instruction() noexcept -> InstructionResult
 
 auto Parser::parse_expression() noexcept -> ExpressionResult
 {
-  auto value = parse_value();
-  if (value.is_err())
+  auto first = parse_value();
+  if (first.is_err())
   {
-    return ExpressionResult::from(value.err());
+    return ExpressionResult::from(first.err());
   }
 
-  if (!attempt<0>(lexer::Token::Kind::Plus))
+  auto op = binary_operator(_lexer.peek_token<0>());
+  if (!op.has_value())
   {
-    // TODO: force type deduction to work, possible overload using function pointers?
-    std::function<ast::Expression(ast::Value)> func = [](auto val)
-    {
-      return ast::Expression(std::move(val));
-    };
-    return value.consume_map(func);
+    return ExpressionResult::from(ast::Expression(_arena, first.consume_ok()));
   }
 
-  _lexer.next();  // Eat attempted Plus
-  auto expr = parse_expression();
-  if (expr.is_err())
+  // Precedence climbing over explicit stacks, so that the depth of the native stack does not
+  // depend on the length of the expression
+  std::vector<ast::Expression> operands;
+  std::vector<BinaryOperator> operators;
+  operands.emplace_back(_arena, first.consume_ok());
+  auto reduce = [this, &operands, &operators]()
   {
-    return ExpressionResult::from(expr.err());
+    auto b = std::move(operands.back());
+    operands.pop_back();
+    operands.back() = ast::Expression(
+        _arena, ast::Operator(_arena, operators.back().type, std::move(operands.back()),
+                              std::move(b)));
+    operators.pop_back();
+  };
+
+  for (; op.has_value(); op = binary_operator(_lexer.peek_token<0>()))
+  {
+    _lexer.next();  // Eat the operator
+    // Operators are left associative, so operators of the same precedence are applied first
+    while (!operators.empty() && operators.back().precedence >= op->precedence)
+    {
+      reduce();
+    }
+    operators.push_back(*op);
+
+    auto value = parse_value();
+    if (value.is_err())
+    {
+      return ExpressionResult::from(value.err());
+    }
+    operands.emplace_back(_arena, value.consume_ok());
   }
 
-  ast::Operator::Builder opBuilder;
-  opBuilder.set_type(ast::Operator::Type::Add);
-  opBuilder.set_a(ast::Expression(value.consume_ok()));
-  opBuilder.set_b(expr.consume_ok());
-  return ExpressionResult::from(ast::Expression(opBuilder.build()));
+  while (!operators.empty())
+  {
+    reduce();
+  }
+  return ExpressionResult::from(std::move(operands.back()));
 }
 
 auto Parser::parse_value() noexcept -> ValueResult
 {
-  ast::Value::Builder builder;
+  ast::Value::Builder builder(_arena);
 
   auto maybeConstant = attempt<0>(lexer::Token::Kind::Number);
-  auto maybeVariable = attempt<0>(lexer::Token::Kind::Identifier);
+  auto maybeVariable = attempt<0>(lexer::Token::Kind::ValueIdentifier);
   if (maybeConstant.has_value())
   {
     _lexer.next();
-    auto lexeme = maybeConstant->lexeme();
-    if (lexeme.find('.') == std::string_view::npos)
-    {
-      int64_t val = 0;
-      auto [ptr, _] = std::from_chars(lexeme.data(), lexeme.data() + lexeme.size(), val);
-      assert(ptr == lexeme.data() + lexeme.size());
-      builder.set_constant(val);
-    }
-    else
-    {
-      double val = NAN;
-      auto [ptr, _] = std::from_chars(lexeme.data(), lexeme.data() + lexeme.size(), val);
-      assert(ptr == lexeme.data() + lexeme.size());
-      builder.set_constant(val);
-    }
+    std::visit(
+        [&builder](auto val)
+        {
+          builder.set_constant(val);
+        },
+        number_literal(maybeConstant->lexeme()));
   }
   else if (maybeVariable.has_value())
   {
     _lexer.next();
-    builder.set_local(maybeVariable->lexeme());
+    builder.set_local(*maybeVariable->symbol());
   }
   else
   {
@@ -180,3 +245,147 @@ auto Parser::parse_value() noexcept -> ValueResult
 
   return ValueResult::from(builder.build());
 }
+
+auto Parser::parse_flat_program() noexcept -> FlatTreeResult
+{
+  ast::FlatTree tree;
+  while (!_lexer.is_halted())
+  {
+    auto instruction = parse_flat_instruction(tree);
+    if (instruction.is_err())
+    {
+      return FlatTreeResult::from(instruction.err());
+    }
+  }
+
+  return FlatTreeResult::from(std::move(tree));
+}
+
+auto Parser::parse_flat_instruction(ast::FlatTree& tree) noexcept -> NodeResult
+{
+  auto head = _lexer.next();
+
+  std::optional<ast::FlatTree::NodeId> instruction;
+  if (is_word(head, lexer::Token::Kind::Keyword, keyword::kLet))
+  {
+    auto variable = expect(lexer::Token::Kind::ValueIdentifier);
+    if (variable.is_err())
+    {
+      return NodeResult::from(variable.err());
+    }
+
+    auto equals = expect(lexer::Token::Kind::Equal);
+    if (equals.is_err())
+    {
+      return NodeResult::from(equals.err());
+    }
+
+    auto expression = parse_flat_expression(tree);
+    if (expression.is_err())
+    {
+      return NodeResult::from(expression.err());
+    }
+    instruction = tree.add_binding(*variable->symbol(), expression.ok());
+  }
+  else if (is_word(head, lexer::Token::Kind::ValueIdentifier, keyword::kPrint))
+  {
+    auto expression = parse_flat_expression(tree);
+    if (expression.is_err())
+    {
+      return NodeResult::from(expression.err());
+    }
+    instruction = tree.add_print(expression.ok());
+  }
+  else
+  {
+    return NodeResult::from(
+        ParseError::invalid_instruction(head, "must begin with 'let' or 'print'\n"));
+  }
+
+  auto newline = expect(lexer::Token::Kind::Newline);
+  if (newline.is_err())
+  {
+    return NodeResult::from(newline.err());
+  }
+
+  return NodeResult::from(*instruction);
+}
+
+auto Parser::parse_flat_expression(ast::FlatTree& tree) noexcept -> NodeResult
+{
+  auto first = parse_flat_value(tree);
+  if (first.is_err())
+  {
+    return first;
+  }
+
+  auto op = binary_operator(_lexer.peek_token<0>());
+  if (!op.has_value())
+  {
+    return first;
+  }
+
+  // The same precedence climbing as parse_expression, over node ids
+  std::vector<ast::FlatTree::NodeId> operands{first.ok()};
+  std::vector<BinaryOperator> operators;
+  auto reduce = [&tree, &operands, &operators]()
+  {
+    auto b = operands.back();
+    operands.pop_back();
+    operands.back() = tree.add_operator(operators.back().type, operands.back(), b);
+    operators.pop_back();
+  };
+
+  for (; op.has_value(); op = binary_operator(_lexer.peek_token<0>()))
+  {
+    _lexer.next();  // Eat the operator
+    while (!operators.empty() && operators.back().precedence >= op->precedence)
+    {
+      reduce();
+    }
+    operators.push_back(*op);
+
+    auto value = parse_flat_value(tree);
+    if (value.is_err())
+    {
+      return value;
+    }
+    operands.push_back(value.ok());
+  }
+
+  while (!operators.empty())
+  {
+    reduce();
+  }
+  return NodeResult::from(operands.back());
+}
+
+auto Parser::parse_flat_value(ast::FlatTree& tree) noexcept -> NodeResult
+{
+  if (auto constant = attempt<0>(lexer::Token::Kind::Number))
+  {
+    _lexer.next();
+    return NodeResult::from(std::visit(
+        [&tree](auto val)
+        {
+          if constexpr (std::is_same_v<decltype(val), int64_t>)
+          {
+            return tree.add_integer(val);
+          }
+          else
+          {
+            return tree.add_double(val);
+          }
+        },
+        number_literal(constant->lexeme())));
+  }
+
+  if (auto variable = attempt<0>(lexer::Token::Kind::ValueIdentifier))
+  {
+    _lexer.next();
+    return NodeResult::from(tree.add_local(*variable->symbol()));
+  }
+
+  auto unexpected = _lexer.next();
+  return NodeResult::from(ParseError::unexpected_token(unexpected, "malformed number literal"));
+}
@@ -0,0 +1,197 @@
+#include <catch.hpp>
+
+#include <cstdint>
+#include <cstdio>
+#include <filesystem>
+#include <fstream>
+#include <string>
+#include <vector>
+
+#include "bytecode/bytecode_file.hpp"
+#include "bytecode/code_view.hpp"
+#include "bytecode/instruction_stream.hpp"
+#include "bytecode/opcode.hpp"
+#include "bytecode/vm.hpp"
+#include "tests/bytecode/capture_output.hpp"
+#include "util/file_system.hpp"
+
+using jackal::bytecode::code_view;
+using jackal::bytecode::file_header;
+using jackal::bytecode::instruction_stream;
+using jackal::bytecode::mapped_file;
+using jackal::bytecode::opcode;
+using jackal::bytecode::verify;
+using jackal::bytecode::vm;
+using jackal::bytecode::write_file;
+
+namespace
+{
+auto run(code_view const& code) -> std::string
+{
+  vm machine;
+  return jackal::tests::capture_output([&](std::FILE* output) { machine.run(code, output); });
+}
+
+auto sample() -> instruction_stream
+{
+  // let x = 2 + 2
+  // print x + (2^40)
+  instruction_stream code;
+  code.emit_constant(0, 2);
+  code.emit_add(0, 0, 0);
+  code.emit_store(0, 0);
+  code.emit_load(1, 0);
+  code.emit_constant(2, int64_t{1} << 40);
+  code.emit_add(1, 1, 2);
+  code.emit_print(1);
+  return code;
+}
+
+auto read_bytes(std::filesystem::path const& path) -> std::vector<char>
+{
+  std::ifstream input(path, std::ios::binary);
+  return {std::istreambuf_iterator<char>(input), std::istreambuf_iterator<char>()};
+}
+
+void write_bytes(std::filesystem::path const& path, std::vector<char> const& bytes)
+{
+  std::ofstream output(path, std::ios::binary | std::ios::trunc);
+  output.write(bytes.data(), static_cast<std::streamsize>(bytes.size()));
+}
+}  // namespace
+
+TEST_CASE("Bytecode files should run the same as the stream they were written from",
+          "[bytecode]")
+{
+  auto code = sample();
+  jackal::util::TemporaryDirectory dir;
+  auto path = dir.directory() / "round_trip.jkb";
+  REQUIRE_FALSE(write_file(code, path).has_value());
+
+  auto loaded = mapped_file::load(path);
+  REQUIRE(loaded.is_ok());
+  auto file = loaded.consume_ok();
+  REQUIRE(file.header().register_count == code.register_count());
+  REQUIRE(file.header().local_count == code.local_count());
+  REQUIRE(file.header().constant_count == 1);
+  REQUIRE(file.view().size == code.size());
+  REQUIRE(run(file.view()) == run(code.view()));
+  REQUIRE(run(file.view()) == "1099511627780\n");
+}
+
+TEST_CASE("Bytecode files should be rejected when their header is wrong", "[bytecode]")
+{
+  jackal::util::TemporaryDirectory dir;
+  auto path = dir.directory() / "header.jkb";
+  REQUIRE_FALSE(write_file(sample(), path).has_value());
+  auto bytes = read_bytes(path);
+
+  SECTION("missing file")
+  {
+    std::filesystem::remove(path);
+    REQUIRE(mapped_file::load(path).is_err());
+  }
+
+  SECTION("bad magic number")
+  {
+    bytes[0] = 'x';
+    write_bytes(path, bytes);
+    REQUIRE(mapped_file::load(path).is_err());
+  }
+
+  SECTION("unsupported version")
+  {
+    auto header = reinterpret_cast<file_header*>(bytes.data());  // NOLINT
+    header->version = file_header::current_version + 1;
+    write_bytes(path, bytes);
+    REQUIRE(mapped_file::load(path).is_err());
+  }
+
+  SECTION("frame too large to allocate")
+  {
+    auto header = reinterpret_cast<file_header*>(bytes.data());  // NOLINT
+    header->register_count = UINT32_MAX;
+    header->local_count = UINT32_MAX;
+    write_bytes(path, bytes);
+    REQUIRE(mapped_file::load(path).is_err());
+  }
+
+  SECTION("truncated code")
+  {
+    bytes.pop_back();
+    write_bytes(path, bytes);
+    REQUIRE(mapped_file::load(path).is_err());
+  }
+
+  SECTION("shorter than a header")
+  {
+    bytes.resize(sizeof(file_header) / 2);
+    write_bytes(path, bytes);
+    REQUIRE(mapped_file::load(path).is_err());
+  }
+}
+
+TEST_CASE("Verification should accept streams built by instruction_stream", "[bytecode]")
+{
+  REQUIRE_FALSE(verify(instruction_stream().view()).has_value());
+  REQUIRE_FALSE(verify(sample().view()).has_value());
+}
+
+TEST_CASE("Verification should reject code the vm could not run safely", "[bytecode]")
+{
+  auto code = sample();
+  std::vector<uint8_t> bytes(code.code(), code.code() + code.size());
+  auto view = code.view();
+  view.code = bytes.data();
+
+  SECTION("registers out of range")
+  {
+    view.register_count = 2;
+    REQUIRE(verify(view).has_value());
+  }
+
+  SECTION("locals out of range")
+  {
+    view.local_count = 0;
+    REQUIRE(verify(view).has_value());
+  }
+
+  SECTION("frame over the limit")
+  {
+    view.local_count = file_header::max_frame_slots - view.register_count + 1;
+    REQUIRE(verify(view).has_value());
+  }
+
+  SECTION("constants out of range")
+  {
+    view.constant_count = 0;
+    REQUIRE(verify(view).has_value());
+  }
+
+  SECTION("unknown opcode")
+  {
+    bytes[0] = 0xff;
+    REQUIRE(verify(view).has_value());
+  }
+
+  SECTION("operand encodings that do not match the opcode")
+  {
+    bytes[1] ^= 0b1100U;
+    REQUIRE(verify(view).has_value());
+  }
+
+  SECTION("missing halt")
+  {
+    view.size -= 2;
+    REQUIRE(verify(view).has_value());
+  }
+
+  SECTION("code after halt")
+  {
+    bytes.push_back(static_cast<uint8_t>(opcode::halt));
+    bytes.push_back(0);
+    view.code = bytes.data();
+    view.size = bytes.size();
+    REQUIRE(verify(view).has_value());
+  }
+}
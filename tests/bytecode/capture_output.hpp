@@ -0,0 +1,28 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdio>
+#include <cstdlib>
+#include <string>
+
+namespace jackal::tests
+{
+/// @brief Collects everything printed to a stream, so that programs run by a test can be checked
+/// against their expected output.
+///
+/// @param write called with the stream to print to, which is closed once it returns
+/// @returns everything @p write printed
+template <typename Write>
+std::string capture_output(Write&& write)
+{
+  char* buffer = nullptr;
+  std::size_t size = 0;
+  auto* output = open_memstream(&buffer, &size);
+  write(output);
+  std::fclose(output);
+
+  std::string printed(buffer, size);
+  std::free(buffer);  // NOLINT
+  return printed;
+}
+}  // namespace jackal::tests
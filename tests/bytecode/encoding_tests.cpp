@@ -0,0 +1,99 @@
+#include <catch.hpp>
+
+#include <cstdint>
+#include <limits>
+
+#include "bytecode/decoder.hpp"
+#include "bytecode/encoding.hpp"
+#include "bytecode/instruction_stream.hpp"
+#include "bytecode/opcode.hpp"
+
+using jackal::bytecode::decoder;
+using jackal::bytecode::instruction_stream;
+using jackal::bytecode::opcode;
+using jackal::bytecode::operand_type;
+
+namespace encoding = jackal::bytecode::encoding;
+
+TEST_CASE("Instruction stream should always end with halt", "[bytecode][encoding]")
+{
+  instruction_stream code;
+  REQUIRE(code.size() == encoding::instruction_size(opcode::halt));
+  REQUIRE(code.instruction_count() == 1);
+
+  code.emit_constant(3, 42);
+  REQUIRE(code.instruction_count() == 2);
+  REQUIRE(code.size() ==
+          encoding::instruction_size(opcode::constant) + encoding::instruction_size(opcode::halt));
+  REQUIRE(code.code()[encoding::instruction_size(opcode::constant)] ==
+          static_cast<uint8_t>(opcode::halt));
+  REQUIRE(code.register_count() == 4);
+  REQUIRE(code.local_count() == 0);
+}
+
+TEST_CASE("Instructions should be packed into a header and 32-bit operands", "[bytecode][encoding]")
+{
+  instruction_stream code;
+  code.emit_add(1, 2, 3);
+
+  REQUIRE(encoding::instruction_size(opcode::add) == 14);
+  REQUIRE(code.code()[0] == static_cast<uint8_t>(opcode::add));
+  REQUIRE(encoding::read_operand(code.code(), 0) == 1);
+  REQUIRE(encoding::read_operand(code.code(), 1) == 2);
+  REQUIRE(encoding::read_operand(code.code(), 2) == 3);
+}
+
+TEST_CASE("Only constants wider than 32 bits should use the constant pool", "[bytecode][encoding]")
+{
+  instruction_stream code;
+  code.emit_constant(0, std::numeric_limits<int32_t>::min());
+  code.emit_constant(0, std::numeric_limits<int64_t>::max());
+  code.emit_constant(1, std::numeric_limits<int64_t>::max());
+
+  REQUIRE(code.constants().size() == 1);
+  REQUIRE(code.code()[0] == static_cast<uint8_t>(opcode::constant));
+  auto const* wide = code.code() + encoding::instruction_size(opcode::constant);
+  REQUIRE(wide[0] == static_cast<uint8_t>(opcode::wide_constant));
+}
+
+TEST_CASE("Decoder should read back every encoded instruction", "[bytecode][encoding]")
+{
+  instruction_stream code;
+  code.emit_constant(0, -3);
+  code.emit_constant(1, std::numeric_limits<int64_t>::min());
+  code.emit_add(2, 0, 1);
+  code.emit_store(4, 2);
+  code.emit_load(0, 4);
+  code.emit_print(0);
+
+  decoder instructions(code);
+
+  auto constant = instructions.next();
+  REQUIRE(constant->op == opcode::constant);
+  REQUIRE(constant->operands[0].as_register() == 0);
+  REQUIRE(constant->operands[1].as_constant() == -3);
+
+  auto wide = instructions.next();
+  REQUIRE(wide->op == opcode::wide_constant);
+  REQUIRE(wide->operands[1].as_constant() == std::numeric_limits<int64_t>::min());
+
+  auto add = instructions.next();
+  REQUIRE(add->op == opcode::add);
+  REQUIRE(add->operand_count == 3);
+  REQUIRE(add->operands[2].as_register() == 1);
+
+  auto store = instructions.next();
+  REQUIRE(store->op == opcode::store);
+  REQUIRE(store->operands[0].type() == operand_type::local);
+  REQUIRE(store->operands[0].as_local() == 4);
+
+  auto load = instructions.next();
+  REQUIRE(load->op == opcode::load);
+  REQUIRE(load->operands[1].as_local() == 4);
+
+  auto print = instructions.next();
+  REQUIRE(print->op == opcode::print);
+  REQUIRE(print->operand_count == 1);
+
+  REQUIRE_FALSE(instructions.next().has_value());
+}
@@ -0,0 +1,219 @@
+#include <catch.hpp>
+
+#include <cstdint>
+#include <cstdio>
+#include <string>
+#include <vector>
+
+#include "bytecode/bytecode_file.hpp"
+#include "bytecode/decoder.hpp"
+#include "bytecode/fusion.hpp"
+#include "bytecode/instruction_stream.hpp"
+#include "bytecode/opcode.hpp"
+#include "bytecode/profile.hpp"
+#include "bytecode/vm.hpp"
+#include "tests/bytecode/capture_output.hpp"
+
+using jackal::bytecode::decoder;
+using jackal::bytecode::dispatch_profile;
+using jackal::bytecode::fuse;
+using jackal::bytecode::instruction_stream;
+using jackal::bytecode::opcode;
+using jackal::bytecode::verify;
+using jackal::bytecode::vm;
+
+namespace
+{
+auto run(instruction_stream const& code) -> std::string
+{
+  vm machine;
+  return jackal::tests::capture_output([&](std::FILE* output) { machine.run(code, output); });
+}
+
+auto opcodes(instruction_stream const& code) -> std::vector<opcode>
+{
+  std::vector<opcode> ops;
+  decoder reader(code);
+  while (auto instruction = reader.next())
+  {
+    ops.push_back(instruction->op);
+  }
+  return ops;
+}
+
+/// The bytecode generator's output for tests/resources/print_expression.jkl
+auto print_expression() -> instruction_stream
+{
+  instruction_stream code;
+  code.emit_constant(0, 1);  // let x = 1
+  code.emit_store(0, 0);
+  code.emit_constant(0, 2);  // let y = 2
+  code.emit_store(1, 0);
+  code.emit_load(0, 0);  // let z = x + y
+  code.emit_load(1, 1);
+  code.emit_add(0, 0, 1);
+  code.emit_store(2, 0);
+  code.emit_constant(0, 3);  // let a = 3 + 4
+  code.emit_constant(1, 4);
+  code.emit_add(0, 0, 1);
+  code.emit_store(3, 0);
+  code.emit_load(0, 3);  // print a + z
+  code.emit_load(1, 2);
+  code.emit_add(0, 0, 1);
+  code.emit_print(0);
+  code.emit_load(0, 2);  // let b = z + a
+  code.emit_load(1, 3);
+  code.emit_add(0, 0, 1);
+  code.emit_store(4, 0);
+  code.emit_load(0, 4);  // print b
+  code.emit_print(0);
+  return code;
+}
+}  // namespace
+
+TEST_CASE("Fusion should rewrite generated code into superinstructions", "[bytecode][fusion]")
+{
+  auto code = print_expression();
+  auto fused = fuse(code);
+
+  REQUIRE(opcodes(fused) == std::vector{opcode::store_const,
+                                        opcode::store_const,
+                                        opcode::add_local_local,
+                                        opcode::store,
+                                        opcode::constant,
+                                        opcode::constant,
+                                        opcode::add,
+                                        opcode::store,
+                                        opcode::add_local_local,
+                                        opcode::print,
+                                        opcode::add_local_local,
+                                        opcode::store,
+                                        opcode::load,
+                                        opcode::print});
+  REQUIRE_FALSE(verify(fused.view()).has_value());
+  REQUIRE(run(fused) == run(code));
+  REQUIRE(run(fused) == "10\n10\n");
+}
+
+TEST_CASE("Fusion should leave the same values in locals", "[bytecode][fusion]")
+{
+  auto code = print_expression();
+  vm original;
+  vm fused;
+  auto* devNull = std::fopen("/dev/null", "w");
+  original.run(code, devNull);
+  fused.run(fuse(code), devNull);
+  std::fclose(devNull);
+
+  REQUIRE(fused.locals().size() == original.locals().size());
+  for (std::size_t i = 0; i < original.locals().size(); ++i)
+  {
+    REQUIRE(fused.locals()[i] == original.locals()[i]);
+  }
+}
+
+TEST_CASE("Fusion should combine a constant with a local in either order", "[bytecode][fusion]")
+{
+  instruction_stream code;
+  code.emit_constant(0, 7);
+  code.emit_store(0, 0);
+  code.emit_load(0, 0);
+  code.emit_constant(1, -3);
+  code.emit_add(0, 0, 1);
+  code.emit_print(0);
+  code.emit_constant(0, 5);
+  code.emit_load(1, 0);
+  code.emit_add(0, 1, 0);
+  code.emit_print(0);
+
+  auto fused = fuse(code);
+  REQUIRE(opcodes(fused) == std::vector{opcode::store_const, opcode::add_const_local, opcode::print,
+                                        opcode::add_const_local, opcode::print});
+  REQUIRE(run(fused) == "4\n12\n");
+}
+
+TEST_CASE("Fusion should keep registers that are read again", "[bytecode][fusion]")
+{
+  instruction_stream code;
+  code.emit_constant(0, 7);
+  code.emit_store(0, 0);
+  code.emit_print(0);
+  code.emit_load(1, 0);
+  code.emit_load(2, 0);
+  code.emit_add(3, 1, 2);
+  code.emit_print(1);
+  code.emit_print(3);
+
+  auto fused = fuse(code);
+  REQUIRE(opcodes(fused) == opcodes(code));
+  REQUIRE(run(fused) == "7\n7\n14\n");
+}
+
+TEST_CASE("Fusion should not fuse wide constants", "[bytecode][fusion]")
+{
+  instruction_stream code;
+  code.emit_constant(0, INT64_MAX);
+  code.emit_store(0, 0);
+  code.emit_load(0, 0);
+  code.emit_print(0);
+
+  auto fused = fuse(code);
+  REQUIRE(opcodes(fused) == opcodes(code));
+  REQUIRE(run(fused) == "9223372036854775807\n");
+}
+
+TEST_CASE("Fusion should wrap overflowing additions as the unfused code does",
+          "[bytecode][fusion]")
+{
+  instruction_stream code;
+  code.emit_constant(0, INT64_MAX);
+  code.emit_store(0, 0);
+  code.emit_load(0, 0);
+  code.emit_load(1, 0);
+  code.emit_add(0, 0, 1);
+  code.emit_print(0);
+  code.emit_load(0, 0);
+  code.emit_constant(1, 1);
+  code.emit_add(0, 0, 1);
+  code.emit_print(0);
+
+  auto fused = fuse(code);
+  REQUIRE(opcodes(fused) == std::vector{opcode::wide_constant, opcode::store,
+                                        opcode::add_local_local, opcode::print,
+                                        opcode::add_const_local, opcode::print});
+  REQUIRE(run(fused) == run(code));
+  REQUIRE(run(fused) == "-2\n" + std::to_string(INT64_MIN) + "\n");
+}
+
+TEST_CASE("Dispatch profiles should count consecutive opcodes", "[bytecode][fusion]")
+{
+  dispatch_profile profile;
+  profile.record(print_expression().view(), 2);
+  REQUIRE(profile.dispatches() == 44);
+
+  // add store, store load, load add and load load each appear three times per run
+  auto pairs = profile.hottest(2, 4);
+  REQUIRE(pairs.size() == 4);
+  REQUIRE(pairs[0].ops[0] == opcode::add);
+  REQUIRE(pairs[0].ops[1] == opcode::store);
+  REQUIRE(pairs[1].ops[0] == opcode::store);
+  REQUIRE(pairs[1].ops[1] == opcode::load);
+  REQUIRE(pairs[2].ops[0] == opcode::load);
+  REQUIRE(pairs[2].ops[1] == opcode::add);
+  REQUIRE(pairs[3].ops[0] == opcode::load);
+  REQUIRE(pairs[3].ops[1] == opcode::load);
+  for (auto const& pair : pairs)
+  {
+    REQUIRE(pair.length == 2);
+    REQUIRE(pair.count == 6);
+  }
+
+  auto triples = profile.hottest(3, 100);
+  REQUIRE(triples.front().length == 3);
+  REQUIRE(triples.front().count == 6);
+  REQUIRE(triples.front().ops == std::array{opcode::load, opcode::load, opcode::add});
+  for (std::size_t i = 1; i < triples.size(); ++i)
+  {
+    REQUIRE(triples[i - 1].count >= triples[i].count);
+  }
+}
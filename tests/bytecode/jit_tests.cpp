@@ -0,0 +1,101 @@
+#include <catch.hpp>
+
+#include <cstdint>
+#include <cstdio>
+#include <string>
+
+#include "bytecode/fusion.hpp"
+#include "bytecode/instruction_stream.hpp"
+#include "bytecode/jit.hpp"
+#include "bytecode/vm.hpp"
+#include "tests/bytecode/capture_output.hpp"
+
+using jackal::bytecode::instruction_stream;
+using jackal::bytecode::native_code;
+using jackal::bytecode::vm;
+
+namespace
+{
+template <typename Code>
+auto run(vm& machine, Code const& code) -> std::string
+{
+  return jackal::tests::capture_output([&](std::FILE* output) { machine.run(code, output); });
+}
+
+auto every_opcode() -> instruction_stream
+{
+  instruction_stream code;
+  code.emit_constant(0, -7);
+  code.emit_store(0, 0);
+  code.emit_constant(1, INT64_MAX);
+  code.emit_constant(2, INT64_MIN + 1);
+  code.emit_add(1, 1, 2);
+  code.emit_print(1);
+  code.emit_load(3, 0);
+  code.emit_print(3);
+  code.emit_add_local_local(0, 0, 0);
+  code.emit_store(1, 0);
+  code.emit_add_const_local(0, -100, 1);
+  code.emit_print(0);
+  code.emit_store_const(2, 123456);
+  code.emit_load(0, 2);
+  code.emit_print(0);
+  return code;
+}
+}  // namespace
+
+TEST_CASE("JIT compiled code should only be produced on supported hosts", "[bytecode][jit]")
+{
+  auto native = native_code::compile(instruction_stream().view());
+  REQUIRE(native.has_value() == native_code::supported);
+}
+
+TEST_CASE("JIT compiled code should print and store what the interpreter does", "[bytecode][jit]")
+{
+  auto code = every_opcode();
+  auto native = native_code::compile(code.view());
+  if (!native.has_value())
+  {
+    WARN("The JIT does not support this host");
+    return;
+  }
+
+  vm interpreter;
+  vm compiled;
+  REQUIRE(run(interpreter, code) == "0\n-7\n-114\n123456\n");
+  REQUIRE(run(compiled, *native) == run(interpreter, code));
+  REQUIRE(compiled.locals().size() == 3);
+  REQUIRE(compiled.locals()[0] == -7);
+  REQUIRE(compiled.locals()[1] == -14);
+  REQUIRE(compiled.locals()[2] == 123456);
+}
+
+TEST_CASE("JIT compiled code should be reusable across runs", "[bytecode][jit]")
+{
+  instruction_stream code;
+  code.emit_load(0, 0);
+  code.emit_add_const_local(0, 1, 0);
+  code.emit_store(0, 0);
+  code.emit_print(0);
+
+  auto native = native_code::compile(fuse(code).view());
+  if (!native.has_value())
+  {
+    WARN("The JIT does not support this host");
+    return;
+  }
+
+  vm machine;
+  REQUIRE(run(machine, *native) == "1\n");
+  REQUIRE(run(machine, *native) == "1\n");
+}
+
+TEST_CASE("VM should print the same values whether or not the JIT supports the host",
+          "[bytecode][jit]")
+{
+  auto code = every_opcode();
+  vm machine;
+  auto printed = jackal::tests::capture_output([&](std::FILE* output)
+                                               { machine.run_native(code.view(), output); });
+  REQUIRE(printed == "0\n-7\n-114\n123456\n");
+}
@@ -0,0 +1,126 @@
+#include <catch.hpp>
+
+#include <cstdint>
+#include <cstdio>
+#include <string>
+
+#include "bytecode/instruction_stream.hpp"
+#include "bytecode/vm.hpp"
+#include "tests/bytecode/capture_output.hpp"
+
+using jackal::bytecode::instruction_stream;
+using jackal::bytecode::vm;
+
+namespace
+{
+auto run(vm& machine, instruction_stream const& code) -> std::string
+{
+  return jackal::tests::capture_output([&](std::FILE* output) { machine.run(code, output); });
+}
+}  // namespace
+
+TEST_CASE("VM should halt immediately on an empty stream", "[bytecode]")
+{
+  vm machine;
+  REQUIRE(run(machine, instruction_stream()).empty());
+}
+
+TEST_CASE("VM should print the sum of constants", "[bytecode]")
+{
+  // print 2 + 2
+  instruction_stream code;
+  code.emit_constant(0, 2);
+  code.emit_constant(1, 2);
+  code.emit_add(2, 0, 1);
+  code.emit_print(2);
+
+  vm machine;
+  REQUIRE(run(machine, code) == "4\n");
+}
+
+TEST_CASE("VM should load constants wider than 32 bits from the pool", "[bytecode]")
+{
+  instruction_stream code;
+  code.emit_constant(0, INT64_MAX);
+  code.emit_constant(1, INT64_MIN + 1);
+  code.emit_add(0, 0, 1);
+  code.emit_print(0);
+  code.emit_constant(0, -5);
+  code.emit_print(0);
+
+  vm machine;
+  REQUIRE(run(machine, code) == "0\n-5\n");
+}
+
+TEST_CASE("VM should wrap additions that overflow", "[bytecode]")
+{
+  instruction_stream code;
+  code.emit_constant(0, INT64_MAX);
+  code.emit_constant(1, 1);
+  code.emit_add(2, 0, 1);
+  code.emit_print(2);
+  code.emit_constant(0, INT64_MIN);
+  code.emit_constant(1, -1);
+  code.emit_add(2, 0, 1);
+  code.emit_print(2);
+
+  vm machine;
+  REQUIRE(run(machine, code) ==
+          std::to_string(INT64_MIN) + "\n" + std::to_string(INT64_MAX) + "\n");
+}
+
+TEST_CASE("VM should store and load locals", "[bytecode]")
+{
+  // let x = -7
+  // let y = x + x
+  // print y
+  instruction_stream code;
+  code.emit_constant(0, -7);
+  code.emit_store(0, 0);
+  code.emit_load(0, 0);
+  code.emit_load(1, 0);
+  code.emit_add(0, 0, 1);
+  code.emit_store(1, 0);
+  code.emit_load(0, 1);
+  code.emit_print(0);
+
+  vm machine;
+  REQUIRE(run(machine, code) == "-14\n");
+  REQUIRE(machine.locals().size() == 2);
+  REQUIRE(machine.locals()[0] == -7);
+  REQUIRE(machine.locals()[1] == -14);
+}
+
+TEST_CASE("VM should reset its state between runs", "[bytecode]")
+{
+  instruction_stream store;
+  store.emit_constant(0, 5);
+  store.emit_store(0, 0);
+
+  instruction_stream print;
+  print.emit_load(0, 0);
+  print.emit_print(0);
+
+  vm machine;
+  REQUIRE(run(machine, store).empty());
+  REQUIRE(run(machine, print) == "0\n");
+}
+
+TEST_CASE("VM frames should hold registers followed by locals", "[bytecode]")
+{
+  instruction_stream code;
+  code.emit_constant(2, 9);
+  code.emit_store(1, 2);
+
+  jackal::bytecode::frame_layout layout(code.view());
+  REQUIRE(layout.register_count == 3);
+  REQUIRE(layout.local_count == 2);
+  REQUIRE(layout.locals_offset() == 3);
+  REQUIRE(layout.size() == 5);
+
+  vm machine;
+  REQUIRE(run(machine, code).empty());
+  REQUIRE(machine.locals().size() == 2);
+  REQUIRE(machine.locals()[0] == 0);
+  REQUIRE(machine.locals()[1] == 9);
+}
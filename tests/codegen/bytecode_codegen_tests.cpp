@@ -0,0 +1,188 @@
+#include <catch.hpp>
+
+#include <cstdint>
+#include <cstdio>
+#include <string>
+
+#include "ast/include.hpp"
+#include "ast/tests/expressions.hpp"
+#include "bytecode/vm.hpp"
+#include "codegen/bytecode/bytecode_visitor.hpp"
+#include "tests/bytecode/capture_output.hpp"
+
+using jackal::ast::Program;
+using jackal::ast::tests::Expressions;
+using jackal::codegen::bytecode::BytecodeVisitor;
+
+namespace
+{
+auto run(BytecodeVisitor const& generator) -> std::string
+{
+  REQUIRE_FALSE(generator.error().has_value());
+  jackal::bytecode::vm machine;
+  return jackal::tests::capture_output([&](std::FILE* output)
+                                       { machine.run(generator.code(), output); });
+}
+}  // namespace
+
+TEST_CASE("Bytecode generation: printing constant valued addition", "[codegen_bytecode]")
+{
+  // print 2 + 2
+  Expressions e;
+  Program program(e.arena);
+  program.add_instruction(e.print(e.add(e.constant(int64_t{2}), e.constant(int64_t{2}))));
+
+  BytecodeVisitor generator;
+  program.accept(generator);
+  REQUIRE(run(generator) == "4\n");
+}
+
+TEST_CASE("Bytecode generation: printing a single bound variable", "[codegen_bytecode]")
+{
+  // let var = 125
+  // print var
+  Expressions e;
+  Program program(e.arena);
+  program.add_instruction(e.let("var", e.constant(int64_t{125})));
+  program.add_instruction(e.print(e.local("var")));
+
+  BytecodeVisitor generator;
+  program.accept(generator);
+  REQUIRE(run(generator) == "125\n");
+  REQUIRE(generator.code().local_count() == 1);
+}
+
+TEST_CASE("Bytecode generation: printing addition of multiple bound variables",
+          "[codegen_bytecode]")
+{
+  // tests/resources/print_expression.jkl
+  Expressions e;
+  Program program(e.arena);
+  program.add_instruction(e.let("x", e.constant(int64_t{1})));
+  program.add_instruction(e.let("y", e.constant(int64_t{2})));
+  program.add_instruction(e.let("z", e.add(e.local("x"), e.local("y"))));
+  program.add_instruction(e.let("a", e.add(e.constant(int64_t{3}), e.constant(int64_t{4}))));
+  program.add_instruction(e.print(e.add(e.local("a"), e.local("z"))));
+  program.add_instruction(e.let("b", e.add(e.local("z"), e.local("a"))));
+  program.add_instruction(e.print(e.local("b")));
+
+  BytecodeVisitor generator;
+  program.accept(generator);
+  REQUIRE(run(generator) == "10\n10\n");
+  // At most two values are live at once: x, z and b share one slot, and y and a the other
+  REQUIRE(generator.code().local_count() == 2);
+}
+
+TEST_CASE("Bytecode generation: registers should be reused once their values are consumed",
+          "[codegen_bytecode]")
+{
+  // let x = 1 + 2
+  // print x + (3 + 4)
+  // print 5
+  Expressions e;
+  Program program(e.arena);
+  program.add_instruction(e.let("x", e.add(e.constant(int64_t{1}), e.constant(int64_t{2}))));
+  auto sum = e.add(e.constant(int64_t{3}), e.constant(int64_t{4}));
+  program.add_instruction(e.print(e.add(e.local("x"), std::move(sum))));
+  program.add_instruction(e.print(e.constant(int64_t{5})));
+
+  BytecodeVisitor generator;
+  program.accept(generator);
+  REQUIRE(run(generator) == "10\n5\n");
+  // x, 3 and 4 are live at once; nothing else needs a register of its own
+  REQUIRE(generator.code().register_count() == 3);
+}
+
+TEST_CASE("Bytecode generation: bindings that are never read should not be lowered",
+          "[codegen_bytecode]")
+{
+  // let unused = 1
+  // let x = 2
+  // let y = x + unused
+  // print x
+  Expressions e;
+  Program program(e.arena);
+  program.add_instruction(e.let("unused", e.constant(int64_t{1})));
+  program.add_instruction(e.let("x", e.constant(int64_t{2})));
+  program.add_instruction(e.let("y", e.add(e.local("x"), e.local("unused"))));
+  program.add_instruction(e.print(e.local("x")));
+
+  BytecodeVisitor generator;
+  program.accept(generator);
+  REQUIRE(run(generator) == "2\n");
+  REQUIRE(generator.code().local_count() == 1);
+}
+
+TEST_CASE("Bytecode generation: a double should be truncated once, as it is stored",
+          "[codegen_bytecode]")
+{
+  // let x = -2.75
+  // print x + 1
+  Expressions e;
+  Program program(e.arena);
+  program.add_instruction(e.let("x", e.floating(-2.75)));
+  program.add_instruction(e.print(e.add(e.local("x"), e.constant(int64_t{1}))));
+
+  BytecodeVisitor generator;
+  program.accept(generator);
+  REQUIRE(run(generator) == "-1\n");
+}
+
+TEST_CASE("Bytecode generation: doubles that C would not truncate on their own should be refused",
+          "[codegen_bytecode]")
+{
+  Expressions e;
+  Program program(e.arena);
+
+  SECTION("a double added to a variable")
+  {
+    // let y = -3
+    // let x = y + 1.5
+    // print x
+    program.add_instruction(e.let("y", e.constant(int64_t{-3})));
+    program.add_instruction(e.let("x", e.add(e.local("y"), e.floating(1.5))));
+    program.add_instruction(e.print(e.local("x")));
+  }
+
+  SECTION("a double printed")
+  {
+    // print 1.5
+    program.add_instruction(e.print(e.floating(1.5)));
+  }
+
+  SECTION("a double that does not fit in an int")
+  {
+    // let x = 1e30
+    // print x
+    program.add_instruction(e.let("x", e.floating(1e30)));
+    program.add_instruction(e.print(e.local("x")));
+  }
+
+  BytecodeVisitor generator;
+  program.accept(generator);
+  REQUIRE(generator.error().has_value());
+}
+
+TEST_CASE("Bytecode generation: deeply nested expressions should not exhaust the stack",
+          "[codegen_bytecode]")
+{
+  constexpr auto Terms = 1000000;
+
+  // let x = 1
+  // print x + x + ... + x
+  Expressions e;
+  Program program(e.arena);
+  program.add_instruction(e.let("x", e.constant(int64_t{1})));
+  auto sum = e.local("x");
+  for (auto i = 1; i < Terms; ++i)
+  {
+    sum = e.add(std::move(sum), e.local("x"));
+  }
+  program.add_instruction(e.print(std::move(sum)));
+
+  BytecodeVisitor generator;
+  program.accept(generator);
+  REQUIRE(run(generator) == std::to_string(Terms) + "\n");
+  // Nested to the left, the running sum and the next term are all that is ever live
+  REQUIRE(generator.code().register_count() == 2);
+}
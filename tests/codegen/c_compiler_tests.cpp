@@ -0,0 +1,140 @@
+#include <catch.hpp>
+
+#include <filesystem>
+#include <limits>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "codegen/c_compiler.hpp"
+#include "codegen/executable.hpp"
+#include "codegen/optimization_profile.hpp"
+#include "codegen/output_buffer.hpp"
+#include "util/file_system.hpp"
+
+using jackal::codegen::CCompiler;
+using jackal::codegen::Executable;
+using jackal::codegen::ExternalCCompiler;
+using jackal::codegen::OptimizationProfile;
+using jackal::codegen::OutputBuffer;
+
+namespace
+{
+auto hello() -> OutputBuffer
+{
+  OutputBuffer source;
+  source.append("#include <stdio.h>\n\nint main(int argc, char** argv) {\n");
+  source.append("printf(\"%d\\n\", 40 + 2);\n}\n");
+  return source;
+}
+}  // namespace
+
+TEST_CASE("External C compilers should be invoked with their flags", "[codegen_c]")
+{
+  jackal::util::TemporaryDirectory dir;
+  auto executable = dir.directory() / "hello.out";
+
+  ExternalCCompiler compiler("cc", {"-O2"});
+  REQUIRE(compiler.compile(hello(), executable));
+  REQUIRE(std::filesystem::exists(executable));
+  REQUIRE(std::filesystem::exists(dir.directory() / "hello.c"));
+
+  ExternalCCompiler missing("/nonexistent/cc");
+  REQUIRE_FALSE(missing.compile(hello(), dir.directory() / "missing.out"));
+}
+
+TEST_CASE("Executables should compile and run through the compiler they are given",
+          "[codegen_c]")
+{
+  Executable executable("hello", hello(), std::make_shared<ExternalCCompiler>("cc"));
+  REQUIRE(executable.execute() == "42\n");
+  REQUIRE(executable.compile().has_value());
+}
+
+TEST_CASE("Double literals should truncate in C as the value they were emitted from",
+          "[codegen_c]")
+{
+  OutputBuffer source;
+  source.append("#include <stdio.h>\n\nint main(int argc, char** argv) {\nint x = ");
+  source.append(0.9999999);
+  source.append(";\nprintf(\"%d\\n\", x);\n}\n");
+
+  Executable executable("truncate", std::move(source), std::make_shared<ExternalCCompiler>("cc"));
+  REQUIRE(executable.execute() == "0\n");
+}
+
+TEST_CASE("Folded double literals should truncate in C as the unfolded sum does", "[codegen_c]")
+{
+  auto program = [](auto emit)
+  {
+    OutputBuffer source;
+    source.append("#include <stdio.h>\n\nint main(int argc, char** argv) {\nint x = ");
+    emit(source);
+    source.append(";\nprintf(\"%d\\n\", x);\n}\n");
+    return Executable("sum", std::move(source), std::make_shared<ExternalCCompiler>("cc"));
+  };
+
+  auto unfolded = program(
+      [](OutputBuffer& source)
+      {
+        source.append(0.4999996);
+        source.append(" + ");
+        source.append(0.4999996);
+      });
+  auto folded = program([](OutputBuffer& source) { source.append(0.4999996 + 0.4999996); });
+  REQUIRE(unfolded.execute() == "0\n");
+  REQUIRE(folded.execute() == "0\n");
+}
+
+TEST_CASE("Non-finite double constants should compile", "[codegen_c]")
+{
+  // Folding 1e308 + 1e308 yields infinity, which has no literal in C
+  auto infinity = std::numeric_limits<double>::max() + std::numeric_limits<double>::max();
+
+  OutputBuffer source;
+  source.append("#include <stdio.h>\n\nint main(int argc, char** argv) {\ndouble a = ");
+  source.append(infinity);
+  source.append(";\ndouble b = ");
+  source.append(-infinity);
+  source.append(";\ndouble c = ");
+  source.append(infinity - infinity);
+  source.append(";\nprintf(\"%d %d %d\\n\", a > 1e308, b < -1e308, c != c);\n}\n");
+
+  Executable executable("non_finite", std::move(source), std::make_shared<ExternalCCompiler>("cc"));
+  REQUIRE(executable.execute() == "1 1 1\n");
+}
+
+TEST_CASE("Optimization profiles should be named on the command line", "[codegen_c]")
+{
+  using jackal::codegen::parse_optimization_profile;
+  for (auto profile : {OptimizationProfile::Debug, OptimizationProfile::Release,
+                       OptimizationProfile::ReleaseNative})
+  {
+    REQUIRE(parse_optimization_profile(jackal::codegen::name(profile)) == profile);
+  }
+  REQUIRE(parse_optimization_profile("release-native") == OptimizationProfile::ReleaseNative);
+  REQUIRE_FALSE(parse_optimization_profile("fast").has_value());
+}
+
+TEST_CASE("Optimization profiles should pick the flags of optimizing builds", "[codegen_c]")
+{
+  using jackal::codegen::c_flags;
+  REQUIRE(c_flags(OptimizationProfile::Release) == std::vector<std::string>{"-O2"});
+  REQUIRE(c_flags(OptimizationProfile::ReleaseNative) ==
+          std::vector<std::string>{"-O3", "-march=native", "-flto"});
+
+  auto release = CCompiler::make(OptimizationProfile::Release);
+  REQUIRE(release->identity() == std::string(ExternalCCompiler::DefaultCommand) + " -O2");
+  auto debug = CCompiler::make_default();
+  REQUIRE(debug->identity() == std::string(ExternalCCompiler::DefaultCommand) + " -O0 -g");
+
+  // Every profile must produce a working program with a real compiler behind it
+  for (auto profile : {OptimizationProfile::Debug, OptimizationProfile::Release,
+                       OptimizationProfile::ReleaseNative})
+  {
+    Executable executable("hello", hello(),
+                          std::make_shared<ExternalCCompiler>("cc", c_flags(profile)));
+    REQUIRE(executable.execute() == "42\n");
+  }
+}
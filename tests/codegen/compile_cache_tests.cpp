@@ -0,0 +1,120 @@
+#include <catch.hpp>
+
+#include <filesystem>
+#include <fstream>
+#include <memory>
+#include <string>
+#include <thread>
+
+#include "codegen/c_compiler.hpp"
+#include "codegen/compile_cache.hpp"
+#include "codegen/output_buffer.hpp"
+#include "codegen/sha256.hpp"
+#include "util/file_system.hpp"
+
+using jackal::codegen::CachingCCompiler;
+using jackal::codegen::CCompiler;
+using jackal::codegen::CompileCache;
+using jackal::codegen::OutputBuffer;
+
+namespace
+{
+/// "Compiles" by writing the source itself as the executable, counting how often it is asked to.
+struct CountingCompiler final : CCompiler
+{
+  explicit CountingCompiler(std::string name) noexcept : name(std::move(name)) {}
+
+  [[nodiscard]] std::string identity() const noexcept override { return name; }
+
+  [[nodiscard]] bool compile(OutputBuffer const& source,
+                             std::filesystem::path const& executable) const noexcept override
+  {
+    ++compilations;
+    std::ofstream output(executable);
+    source.write_to(output);
+    return true;
+  }
+
+  std::string name;
+  mutable int compilations = 0;
+};
+
+auto source(std::string_view text) -> OutputBuffer
+{
+  OutputBuffer buffer;
+  buffer.append(text);
+  return buffer;
+}
+
+auto read(std::filesystem::path const& path) -> std::string
+{
+  return *jackal::util::read_file(path);
+}
+}  // namespace
+
+TEST_CASE("Compile cache keys should depend on the source and the compiler", "[codegen_cache]")
+{
+  auto key = CompileCache::key(source("int main() {}"), "clang -O2");
+  REQUIRE(key == CompileCache::key(source("int main() {}"), "clang -O2"));
+  REQUIRE(key != CompileCache::key(source("int main() { }"), "clang -O2"));
+  REQUIRE(key != CompileCache::key(source("int main() {}"), "clang -O3"));
+  REQUIRE(key.size() == 2 * jackal::codegen::Sha256::DigestSize);
+
+  // Chunk boundaries do not matter
+  OutputBuffer split;
+  split.append("int main(");
+  split.splice(source(") {}"));
+  REQUIRE(key == CompileCache::key(split, "clang -O2"));
+}
+
+TEST_CASE("Caching compilers should only compile each source once", "[codegen_cache]")
+{
+  jackal::util::TemporaryDirectory dir;
+  auto compiler = std::make_shared<CountingCompiler>("counting");
+  CachingCCompiler caching(compiler, CompileCache(dir.directory() / "cache"));
+  REQUIRE(caching.identity() == "counting");
+
+  REQUIRE(caching.compile(source("first"), dir.directory() / "a.out"));
+  REQUIRE(caching.compile(source("first"), dir.directory() / "b.out"));
+  REQUIRE(compiler->compilations == 1);
+  REQUIRE(read(dir.directory() / "b.out") == "first");
+
+  REQUIRE(caching.compile(source("second"), dir.directory() / "a.out"));
+  REQUIRE(compiler->compilations == 2);
+  REQUIRE(read(dir.directory() / "a.out") == "second");
+
+  // A different compiler configuration cannot reuse the first compiler's executables
+  auto other = std::make_shared<CountingCompiler>("other");
+  CachingCCompiler otherCaching(other, CompileCache(dir.directory() / "cache"));
+  REQUIRE(otherCaching.compile(source("first"), dir.directory() / "c.out"));
+  REQUIRE(other->compilations == 1);
+}
+
+TEST_CASE("Compile caches should evict the least recently used executables", "[codegen_cache]")
+{
+  jackal::util::TemporaryDirectory dir;
+  auto cacheDir = dir.directory() / "cache";
+  auto compiler = std::make_shared<CountingCompiler>("counting");
+  CachingCCompiler caching(compiler, CompileCache(cacheDir, 10));
+  auto out = dir.directory() / "a.out";
+  auto pause = [] { std::this_thread::sleep_for(std::chrono::milliseconds(10)); };
+
+  REQUIRE(caching.compile(source("aaaa"), out));
+  pause();
+  REQUIRE(caching.compile(source("bbbb"), out));
+  pause();
+  // Using aaaa makes bbbb the least recently used entry
+  REQUIRE(caching.compile(source("aaaa"), out));
+  pause();
+  REQUIRE(compiler->compilations == 2);
+
+  REQUIRE(caching.compile(source("cccc"), out));
+  REQUIRE(compiler->compilations == 3);
+  REQUIRE(std::distance(std::filesystem::directory_iterator(cacheDir),
+                        std::filesystem::directory_iterator()) == 2);
+
+  REQUIRE(caching.compile(source("aaaa"), out));
+  REQUIRE(compiler->compilations == 3);
+  REQUIRE(caching.compile(source("bbbb"), out));
+  REQUIRE(compiler->compilations == 4);
+}
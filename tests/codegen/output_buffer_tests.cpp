@@ -0,0 +1,107 @@
+#include <catch.hpp>
+
+#include <cstdint>
+#include <cstdlib>
+#include <limits>
+#include <sstream>
+#include <string>
+
+#include "codegen/output_buffer.hpp"
+
+using jackal::codegen::OutputBuffer;
+
+TEST_CASE("Output buffer should concatenate appended code in order", "[output_buffer]")
+{
+  OutputBuffer buffer;
+  buffer.append("int x = ");
+  buffer.append(int64_t{-42});
+  buffer.append(';');
+
+  REQUIRE(buffer.size() == 12);
+  REQUIRE(buffer.str() == "int x = -42;");
+}
+
+TEST_CASE("Output buffer should format numbers as C literals", "[output_buffer]")
+{
+  OutputBuffer buffer;
+  buffer.append(std::numeric_limits<int64_t>::min());
+  buffer.append(' ');
+  buffer.append(1.5);
+  buffer.append(' ');
+  buffer.append(-0.1);
+  buffer.append(' ');
+  buffer.append(2.0);
+  buffer.append(' ');
+  buffer.append(1e30);
+
+  REQUIRE(buffer.str() == "-9223372036854775808 1.5 -0.1 2.0 1e+30");
+}
+
+TEST_CASE("Output buffer should write doubles that read back exactly", "[output_buffer]")
+{
+  // 0.9999999 would print as 1.000000 with six decimal places
+  for (double value : {0.9999999, 0.4999996 + 0.4999996, 0.1 + 0.2,
+                       std::numeric_limits<double>::denorm_min(),
+                       std::numeric_limits<double>::lowest()})
+  {
+    OutputBuffer buffer;
+    buffer.append(value);
+    REQUIRE(std::strtod(buffer.str().c_str(), nullptr) == value);
+  }
+}
+
+TEST_CASE("Output buffer should write non-finite doubles as constant expressions",
+          "[output_buffer]")
+{
+  OutputBuffer buffer;
+  buffer.append(std::numeric_limits<double>::infinity());
+  buffer.append(' ');
+  buffer.append(-std::numeric_limits<double>::infinity());
+  buffer.append(' ');
+  buffer.append(std::numeric_limits<double>::quiet_NaN());
+
+  REQUIRE(buffer.str() == "(1.0 / 0.0) -(1.0 / 0.0) (0.0 / 0.0)");
+}
+
+TEST_CASE("Output buffer should span chunks without losing bytes", "[output_buffer]")
+{
+  std::string large(OutputBuffer::DefaultChunkSize + 10, 'x');
+
+  OutputBuffer buffer;
+  buffer.append("abc");
+  buffer.append(large);
+  buffer.append(std::numeric_limits<double>::max());
+
+  REQUIRE(buffer.chunks().size() > 1);
+  REQUIRE(buffer.str().substr(0, 3 + large.size()) == "abc" + large);
+  REQUIRE(buffer.size() == buffer.str().size());
+}
+
+TEST_CASE("Output buffer splicing should move chunks without copying them", "[output_buffer]")
+{
+  OutputBuffer body;
+  body.append("body");
+  auto const* bodyBytes = body.chunks().front().data();
+
+  OutputBuffer file;
+  file.append("head ");
+  file.splice(std::move(body));
+  file.append(" tail");
+
+  REQUIRE(body.empty());
+  REQUIRE(file.str() == "head body tail");
+  REQUIRE(file.chunks().at(1).data() == bodyBytes);
+}
+
+TEST_CASE("Output buffer should write every chunk to a stream", "[output_buffer]")
+{
+  OutputBuffer head;
+  head.append("first ");
+  OutputBuffer tail;
+  tail.append("second");
+  head.splice(std::move(tail));
+
+  std::ostringstream oss;
+  head.write_to(oss);
+  REQUIRE(oss.str() == "first second");
+}
@@ -0,0 +1,46 @@
+#include <catch.hpp>
+
+#include <string>
+#include <string_view>
+
+#include "codegen/sha256.hpp"
+
+using jackal::codegen::Sha256;
+
+namespace
+{
+auto digest(std::string_view message) -> std::string
+{
+  Sha256 sha;
+  sha.update(message);
+  return Sha256::hex(sha.finish());
+}
+}  // namespace
+
+TEST_CASE("SHA-256 should match the published test vectors", "[sha256]")
+{
+  REQUIRE(digest("") == "e3b0c44298fc1c149afbf4c8996fb92427ae41e4649b934ca495991b7852b855");
+  REQUIRE(digest("abc") == "ba7816bf8f01cfea414140de5dae2223b00361a396177a9cb410ff61f20015ad");
+  REQUIRE(digest("abcdbcdecdefdefgefghfghighijhijkijkljklmklmnlmnomnopnopq") ==
+          "248d6a61d20638b8e5c026930c3e6039a33ce45964ff2167f6ecedd419db06c1");
+  REQUIRE(digest(std::string(1000000, 'a')) ==
+          "cdc76e5c9914fb9281a1c7e284d73e67f1809a48a497200e046d39ccc7112cd0");
+}
+
+TEST_CASE("SHA-256 should not depend on how its input is split", "[sha256]")
+{
+  std::string message(200, 'x');
+  for (std::size_t i = 0; i < message.size(); ++i)
+  {
+    message[i] = static_cast<char>(i);
+  }
+
+  // Split points on either side of the block size and the padding boundary
+  for (std::size_t split : {0, 1, 55, 56, 63, 64, 65, 119, 128, 200})
+  {
+    Sha256 sha;
+    sha.update(std::string_view(message).substr(0, split));
+    sha.update(std::string_view(message).substr(split));
+    REQUIRE(Sha256::hex(sha.finish()) == digest(message));
+  }
+}
@@ -4,11 +4,13 @@
 #include <string>
 #include <string_view>
 
+#include "ast/arena.hpp"
 #include "codegen/c/c_visitor.hpp"
 #include "codegen/executable.hpp"
 #include "parser/include.hpp"
 #include "parser/parse.hpp"
 #include "tests/resource.hpp"
+#include "util/interner.hpp"
 
 namespace jackal::tests
 {
@@ -36,13 +38,15 @@ struct CompilationComparison
   std::optional<std::string> compile_and_compare<CompilationBackend::C>(
       std::string_view expectedOutput)
   {
-    parser::Parser parser(_input.data());
+    ast::Arena arena;
+    util::Interner interner;
+    parser::Parser parser(arena, interner, _input.data());
     auto result = parser.parse_program();
 
-    codegen::c::CVisitor cGen(_name);
+    codegen::c::CVisitor cGen(_name, interner);
     result->accept(cGen);
 
-    auto executable = cGen.generate();
+    auto executable = cGen.generate(codegen::OptimizationProfile::Debug);
     if (executable.source() != _expectedCode.content())
     {
       return executable.source();
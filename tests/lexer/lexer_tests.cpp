@@ -64,7 +64,7 @@ TEST_CASE("Single identifier should lex", "[lexer][lexer_token]")
   auto const* code = "foobar";
   Lexer lexer(code);
 
-  require_next(lexer, Token::Kind::Identifier, "foobar");
+  require_next(lexer, Token::Kind::ValueIdentifier, "foobar");
 }
 
 TEST_CASE("Identifier starting with uppercase should lex", "[lexer][lexer_token]")
@@ -72,7 +72,7 @@ TEST_CASE("Identifier starting with uppercase should lex", "[lexer][lexer_token]
   auto const* code = "Foobar";
   Lexer lexer(code);
 
-  require_next(lexer, Token::Kind::Unknown, "F");
+  require_next(lexer, Token::Kind::TypeIdentifier, "Foobar");
 }
 
 TEST_CASE("Identifier containing uppercase should lex", "[lexer][lexer_token]")
@@ -80,7 +80,8 @@ TEST_CASE("Identifier containing uppercase should lex", "[lexer][lexer_token]")
   auto const* code = "fooBar";
   Lexer lexer(code);
 
-  require_next(lexer, Token::Kind::Identifier, "fooBar");
+  require_next(lexer, Token::Kind::ValueIdentifier, "foo");
+  require_next(lexer, Token::Kind::TypeIdentifier, "Bar");
 }
 
 TEST_CASE("Single integer should lex", "[lexer][lexer_token]")
@@ -131,8 +132,8 @@ TEST_CASE("Constant assignment expression should lex", "[lexer][lexer_expression
   Lexer lexer(code);
 
   require_sequence(lexer, {
-                              {Token::Kind::Identifier, "let"},
-                              {Token::Kind::Identifier, "x"},
+                              {Token::Kind::Keyword, "let"},
+                              {Token::Kind::ValueIdentifier, "x"},
                               {Token::Kind::Equal, "="},
                               {Token::Kind::Number, "12"},
                           });
@@ -144,12 +145,12 @@ TEST_CASE("Compound assignment expression should lex", "[lexer][lexer_expression
   Lexer lexer(code);
 
   require_sequence(lexer, {
-                              {Token::Kind::Identifier, "let"},
-                              {Token::Kind::Identifier, "x"},
+                              {Token::Kind::Keyword, "let"},
+                              {Token::Kind::ValueIdentifier, "x"},
                               {Token::Kind::Equal, "="},
-                              {Token::Kind::Identifier, "y"},
+                              {Token::Kind::ValueIdentifier, "y"},
                               {Token::Kind::Plus, "+"},
-                              {Token::Kind::Identifier, "z"},
+                              {Token::Kind::ValueIdentifier, "z"},
                           });
 }
 
@@ -158,7 +159,7 @@ TEST_CASE("Print expression should lex", "[lexer][lexer_expression]")
   auto const* code = "print 123";
   Lexer lexer(code);
 
-  require_sequence(lexer, {{Token::Kind::Identifier, "print"}, {Token::Kind::Number, "123"}});
+  require_sequence(lexer, {{Token::Kind::ValueIdentifier, "print"}, {Token::Kind::Number, "123"}});
 }
 
 TEST_CASE("Peeking token multiple times should repeatedly return same token", "[lexer]")
@@ -166,7 +167,7 @@ TEST_CASE("Peeking token multiple times should repeatedly return same token", "[
   auto const* code = "print";
   Lexer lexer(code);
 
-  REQUIRE(lexer.peek_token<0>().kind() == Token::Kind::Identifier);
+  REQUIRE(lexer.peek_token<0>().kind() == Token::Kind::ValueIdentifier);
   REQUIRE(lexer.peek_token<0>().lexeme() == "print");
 }
 
@@ -175,9 +176,9 @@ TEST_CASE("Next after peek should return peeked token", "[lexer]")
   auto const* code = "print 456";
   Lexer lexer(code);
 
-  REQUIRE(lexer.peek_token<0>().kind() == Token::Kind::Identifier);
+  REQUIRE(lexer.peek_token<0>().kind() == Token::Kind::ValueIdentifier);
   REQUIRE(lexer.peek_token<0>().lexeme() == "print");
-  require_sequence(lexer, {{Token::Kind::Identifier, "print"}, {Token::Kind::Number, "456"}});
+  require_sequence(lexer, {{Token::Kind::ValueIdentifier, "print"}, {Token::Kind::Number, "456"}});
 }
 
 TEST_CASE("Peeking beyond end of code should return halt", "[lexer]")
@@ -1,14 +1,26 @@
 #include <catch.hpp>
 
+#include <unistd.h>
+
+#include <array>
+#include <string>
+#include <string_view>
+
+#include "ast/arena.hpp"
 #include "ast/include.hpp"
+#include "lexer/stream_source.hpp"
 #include "parser/include.hpp"
 #include "parser/parse.hpp"
+#include "util/interner.hpp"
 
 using jackal::parser::Parser;
+using jackal::util::Interner;
 
 TEST_CASE("Parsing integer constant should return Value", "[parser]")
 {
-  Parser parser("123");
+  jackal::ast::Arena arena;
+  Interner interner;
+  Parser parser(arena, interner, "123");
   auto result = parser.parse_value();
 
   CHECKED_ELSE(result.is_ok()) { FAIL(result.err().message()); }
@@ -17,7 +29,9 @@ TEST_CASE("Parsing integer constant should return Value", "[parser]")
 
 TEST_CASE("Parsing double constant should return Value", "[parser]")
 {
-  Parser parser("1.23");
+  jackal::ast::Arena arena;
+  Interner interner;
+  Parser parser(arena, interner, "1.23");
   auto result = parser.parse_value();
 
   CHECKED_ELSE(result.is_ok()) { FAIL(result.err().message()); }
@@ -26,27 +40,33 @@ TEST_CASE("Parsing double constant should return Value", "[parser]")
 
 TEST_CASE("Parsing variable identifier should return Value", "[parser]")
 {
-  Parser parser("foo");
+  jackal::ast::Arena arena;
+  Interner interner;
+  Parser parser(arena, interner, "foo");
   auto result = parser.parse_value();
 
   CHECKED_ELSE(result.is_ok()) { FAIL(result.err().message()); }
-  REQUIRE(result->local_variable_unsafe().name() == "foo");
+  REQUIRE(interner.name(result->local_variable_unsafe().name()) == "foo");
 }
 
 TEST_CASE("Parsing single binding instruction should return Binding", "[parser]")
 {
-  Parser parser("let x = 2\n");
+  jackal::ast::Arena arena;
+  Interner interner;
+  Parser parser(arena, interner, "let x = 2\n");
   auto result = parser.parse_instruction();
 
   CHECKED_ELSE(result.is_ok()) { FAIL(result.err().message()); }
   auto const& binding = result->binding_unsafe();
-  REQUIRE(binding.variable().name() == "x");
+  REQUIRE(interner.name(binding.variable().name()) == "x");
   REQUIRE(binding.expression().value_unsafe().constant_unsafe().int_unsafe() == 2);
 }
 
 TEST_CASE("Parsing single print instruction should return Print", "[parser]")
 {
-  Parser parser("print 1 + 2\n");
+  jackal::ast::Arena arena;
+  Interner interner;
+  Parser parser(arena, interner, "print 1 + 2\n");
   auto result = parser.parse_instruction();
 
   CHECKED_ELSE(result.is_ok()) { FAIL(result.err().message()); }
@@ -60,20 +80,147 @@ TEST_CASE("Parsing single print instruction should return Print", "[parser]")
 
 TEST_CASE("Parsing program should return all instructions", "[parser]")
 {
-  Parser parser("let x = 1 + 2\nlet y = 3\nprint x + y\n");
+  jackal::ast::Arena arena;
+  Interner interner;
+  Parser parser(arena, interner, "let x = 1 + 2\nlet y = 3\nprint x + y\n");
   auto result = parser.parse_program();
 
   CHECKED_ELSE(result.is_ok()) { FAIL(result.err().message()); }
   REQUIRE(result->instructions().size() == 3);
-  REQUIRE(result->instructions().at(0).binding_unsafe().variable().name() == "x");
-  REQUIRE(result->instructions().at(1).binding_unsafe().variable().name() == "y");
-  REQUIRE(result->instructions()
-              .at(2)
+  auto const& instructions = result->instructions();
+  auto x = instructions.at(0).binding_unsafe().variable().name();
+  REQUIRE(interner.name(x) == "x");
+  REQUIRE(interner.name(instructions.at(1).binding_unsafe().variable().name()) == "y");
+  REQUIRE(instructions.at(2)
               .print_unsafe()
               .expression()
               .operator_unsafe()
               .a()
               .value_unsafe()
               .local_variable_unsafe()
-              .name() == "x");
+              .name() == x);
+}
+
+TEST_CASE("Parsing program from a pipe should return all instructions", "[parser]")
+{
+  std::string_view code = "let x = 12345 + 2.5\nlet y = 3\nprint x + y\n";
+  std::array<int, 2> fds{};
+  REQUIRE(::pipe(fds.data()) == 0);
+  REQUIRE(::write(fds[1], code.data(), code.size()) == static_cast<ssize_t>(code.size()));
+  ::close(fds[1]);
+
+  // Chunks shorter than the number literals force them to be read across refills
+  jackal::ast::Arena arena;
+  Interner interner;
+  jackal::lexer::StreamSource source(fds[0], 2);
+  Parser parser(arena, interner, source);
+  auto result = parser.parse_program();
+  ::close(fds[0]);
+
+  CHECKED_ELSE(result.is_ok()) { FAIL(result.err().message()); }
+  auto const& instructions = result->instructions();
+  REQUIRE(instructions.size() == 3);
+  auto const& sum = instructions.at(0).binding_unsafe().expression().operator_unsafe();
+  REQUIRE(sum.a().value_unsafe().constant_unsafe().int_unsafe() == 12345);
+  REQUIRE(sum.b().value_unsafe().constant_unsafe().double_unsafe() == Approx(2.5));
+  auto y = instructions.at(1).binding_unsafe().variable().name();
+  REQUIRE(interner.name(y) == "y");
+  auto const& print = instructions.at(2).print_unsafe().expression().operator_unsafe();
+  REQUIRE(print.b().value_unsafe().local_variable_unsafe().name() == y);
+}
+
+TEST_CASE("Parsing flat program should return all instructions", "[parser]")
+{
+  jackal::ast::Arena arena;
+  Interner interner;
+  Parser parser(arena, interner, "let x = 1 + 2\nlet y = 3\nprint x + y\n");
+  auto result = parser.parse_flat_program();
+
+  CHECKED_ELSE(result.is_ok()) { FAIL(result.err().message()); }
+  auto const& tree = result.ok();
+  REQUIRE(tree.instructions().size() == 3);
+  REQUIRE(interner.name(tree.name(tree.instructions().at(0))) == "x");
+  REQUIRE(interner.name(tree.name(tree.instructions().at(1))) == "y");
+
+  auto print = tree.expression(tree.instructions().at(2));
+  REQUIRE(tree.kind(print) == jackal::ast::FlatTree::Kind::Add);
+  REQUIRE(tree.name(tree.a(print)) == tree.name(tree.instructions().at(0)));
+  REQUIRE(tree.name(tree.b(print)) == tree.name(tree.instructions().at(1)));
+}
+
+TEST_CASE("Parsing chained additions should associate them to the left", "[parser]")
+{
+  jackal::ast::Arena arena;
+  Interner interner;
+  Parser parser(arena, interner, "print 1 + 2 + 3\n");
+  auto result = parser.parse_instruction();
+
+  CHECKED_ELSE(result.is_ok()) { FAIL(result.err().message()); }
+  auto const& root = result->print_unsafe().expression().operator_unsafe();
+  REQUIRE(root.b().value_unsafe().constant_unsafe().int_unsafe() == 3);
+  auto const& left = root.a().operator_unsafe();
+  REQUIRE(left.a().value_unsafe().constant_unsafe().int_unsafe() == 1);
+  REQUIRE(left.b().value_unsafe().constant_unsafe().int_unsafe() == 2);
+}
+
+TEST_CASE("Parsing flat chained additions should associate them to the left", "[parser]")
+{
+  jackal::ast::Arena arena;
+  Interner interner;
+  Parser parser(arena, interner, "print x + y + z\n");
+  auto result = parser.parse_flat_program();
+
+  CHECKED_ELSE(result.is_ok()) { FAIL(result.err().message()); }
+  auto const& tree = result.ok();
+  auto root = tree.expression(tree.instructions().at(0));
+  REQUIRE(interner.name(tree.name(tree.b(root))) == "z");
+  auto left = tree.a(root);
+  REQUIRE(tree.kind(left) == jackal::ast::FlatTree::Kind::Add);
+  REQUIRE(interner.name(tree.name(tree.a(left))) == "x");
+  REQUIRE(interner.name(tree.name(tree.b(left))) == "y");
+}
+
+TEST_CASE("Parsing long chains of additions should not exhaust the stack", "[parser]")
+{
+  constexpr auto Terms = 1000000;
+
+  std::string code = "print x";
+  for (auto i = 1; i < Terms; ++i)
+  {
+    code += " + x";
+  }
+  code += "\n";
+
+  jackal::ast::Arena arena;
+  Interner interner;
+  Parser parser(arena, interner, code.c_str());
+  auto result = parser.parse_flat_program();
+
+  CHECKED_ELSE(result.is_ok()) { FAIL(result.err().message()); }
+  auto const& tree = result.ok();
+  auto depth = 0;
+  for (auto node = tree.expression(tree.instructions().at(0));
+       tree.kind(node) == jackal::ast::FlatTree::Kind::Add; node = tree.a(node))
+  {
+    ++depth;
+  }
+  REQUIRE(depth == Terms - 1);
+}
+
+TEST_CASE("Parsing instruction should reject words other than let and print", "[parser]")
+{
+  jackal::ast::Arena arena;
+  Interner interner;
+
+  SECTION("a keyword other than let")
+  {
+    Parser parser(arena, interner, "fn x = 2\n");
+    REQUIRE(parser.parse_instruction().is_err());
+  }
+
+  SECTION("an identifier other than print")
+  {
+    Parser parser(arena, interner, "show 2\n");
+    REQUIRE(parser.parse_instruction().is_err());
+  }
 }
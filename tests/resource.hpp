@@ -1,41 +1,48 @@
 #pragma once
 
 #include <filesystem>
-#include <fstream>
-#include <sstream>
+#include <optional>
+#include <string>
 #include <string_view>
 #include <utility>
 
+#include "util/source_buffer.hpp"
+
 namespace jackal::tests
 {
 /// @brief The path for static test resource files.
 static const std::filesystem::path TestResourcePath("./tests/resources");
 
 /// @brief A static file read from disk for testing purposes.
+///
+/// The file is memory-mapped rather than copied. A resource that cannot be read has empty content.
 struct FileTestResource
 {
   /// @brief Constructs a new file resource from a fully-qualified file name.
   ///
   /// @param fileName the name of the file to read, including its extension
-  explicit FileTestResource(std::string fileName) noexcept : _fileName(std::move(fileName))
+  explicit FileTestResource(std::string fileName) noexcept
+      : _fileName(std::move(fileName)), _buffer(util::SourceBuffer::map(TestResourcePath / _fileName))
   {
-    std::ifstream inputStream(TestResourcePath / _fileName);
-    std::stringstream iss;
-    iss << inputStream.rdbuf();
-    _content = iss.str();
   }
 
   /// @returns the fully-qualified name of the file resource
   [[nodiscard]] std::string_view file_name() const noexcept { return _fileName; }
 
   /// @returns the on-disk content of the file resource
-  [[nodiscard]] std::string_view content() const noexcept { return _content; }
+  [[nodiscard]] std::string_view content() const noexcept
+  {
+    return _buffer.has_value() ? _buffer->view() : std::string_view();
+  }
 
   /// @returns the C string representation of the file resource
-  [[nodiscard]] char const* data() const noexcept { return _content.data(); }
+  [[nodiscard]] char const* data() const noexcept
+  {
+    return _buffer.has_value() ? _buffer->data() : "";
+  }
 
  private:
   std::string _fileName;
-  std::string _content;
+  std::optional<util::SourceBuffer> _buffer;
 };
 }  // namespace jackal::tests
@@ -0,0 +1,73 @@
+#include <catch.hpp>
+
+#include <string>
+#include <vector>
+
+#include "util/interner.hpp"
+
+using jackal::util::Interner;
+using jackal::util::Symbol;
+
+TEST_CASE("Interning the same string should return the same Symbol", "[interner]")
+{
+  Interner interner;
+  auto foo = interner.intern("foo");
+  auto bar = interner.intern("bar");
+
+  REQUIRE(foo != bar);
+  REQUIRE(interner.intern(std::string("foo")) == foo);
+  REQUIRE(interner.size() == 2);
+}
+
+TEST_CASE("Symbols should be assigned densely in order of first appearance", "[interner]")
+{
+  Interner interner;
+
+  REQUIRE(interner.intern("a").id() == 0);
+  REQUIRE(interner.intern("b").id() == 1);
+  REQUIRE(interner.intern("a").id() == 0);
+  REQUIRE(interner.intern("").id() == 2);
+  REQUIRE(interner.name(Symbol(2)).empty());
+}
+
+TEST_CASE("Interned names should outlive the string they were interned from", "[interner]")
+{
+  Interner interner;
+  Symbol symbol(0);
+  {
+    std::string name = "a_rather_long_identifier_name";
+    symbol = interner.intern(name);
+    name.assign(name.size(), 'x');
+  }
+
+  REQUIRE(interner.name(symbol) == "a_rather_long_identifier_name");
+}
+
+TEST_CASE("Finding a string should not intern it", "[interner]")
+{
+  Interner interner;
+  auto foo = interner.intern("foo");
+
+  REQUIRE(interner.find("foo") == foo);
+  REQUIRE_FALSE(interner.find("bar").has_value());
+  REQUIRE(interner.size() == 1);
+}
+
+TEST_CASE("Interner should keep every Symbol across growth", "[interner]")
+{
+  constexpr auto Names = 10 * Interner::InitialCapacity;
+
+  Interner interner;
+  std::vector<Symbol> symbols;
+  for (std::size_t i = 0; i < Names; ++i)
+  {
+    symbols.push_back(interner.intern("name_" + std::to_string(i)));
+  }
+
+  REQUIRE(interner.size() == Names);
+  for (std::size_t i = 0; i < Names; ++i)
+  {
+    REQUIRE(interner.intern("name_" + std::to_string(i)) == symbols[i]);
+    REQUIRE(interner.name(symbols[i]) == "name_" + std::to_string(i));
+  }
+}
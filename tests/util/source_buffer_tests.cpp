@@ -0,0 +1,61 @@
+#include <catch.hpp>
+
+#include <fstream>
+#include <string>
+
+#include <unistd.h>
+
+#include "util/file_system.hpp"
+#include "util/source_buffer.hpp"
+
+using jackal::util::SourceBuffer;
+using jackal::util::TemporaryDirectory;
+
+static void write_file(std::filesystem::path const& path, std::string const& content)
+{
+  std::ofstream output(path);
+  output << content;
+}
+
+TEST_CASE("SourceBuffer should map file content with a NUL terminator", "[source_buffer]")
+{
+  TemporaryDirectory temp;
+  auto path = temp.directory() / "source.jkl";
+  write_file(path, "let x = 1\nprint x\n");
+
+  auto buffer = SourceBuffer::map(path);
+  REQUIRE(buffer.has_value());
+  REQUIRE(buffer->view() == "let x = 1\nprint x\n");
+  REQUIRE(buffer->data()[buffer->size()] == '\0');
+}
+
+TEST_CASE("SourceBuffer should terminate files filling an entire page", "[source_buffer]")
+{
+  TemporaryDirectory temp;
+  auto path = temp.directory() / "page.jkl";
+  auto pageSize = static_cast<std::size_t>(sysconf(_SC_PAGESIZE));
+  write_file(path, std::string(pageSize, 'x'));
+
+  auto buffer = SourceBuffer::map(path);
+  REQUIRE(buffer.has_value());
+  REQUIRE(buffer->size() == pageSize);
+  REQUIRE(buffer->data()[pageSize] == '\0');
+}
+
+TEST_CASE("SourceBuffer should map empty files as empty source", "[source_buffer]")
+{
+  TemporaryDirectory temp;
+  auto path = temp.directory() / "empty.jkl";
+  write_file(path, "");
+
+  auto buffer = SourceBuffer::map(path);
+  REQUIRE(buffer.has_value());
+  REQUIRE(buffer->size() == 0);
+  REQUIRE(buffer->data()[0] == '\0');
+}
+
+TEST_CASE("SourceBuffer should not map missing files", "[source_buffer]")
+{
+  TemporaryDirectory temp;
+  REQUIRE_FALSE(SourceBuffer::map(temp.directory() / "missing.jkl").has_value());
+}
@@ -1,5 +1,7 @@
 #include <catch.hpp>
 
+#include <string>
+
 #include "util/source_location.hpp"
 
 using jackal::util::column;
@@ -24,3 +26,25 @@ TEST_CASE("Source location to_string should return debug string", "[source_locat
 
   REQUIRE(jackal::util::to_string(loc) == "let this = reasonable\n    ^\n    └----");
 }
+
+TEST_CASE("Source location on the final line should end at the end of the source",
+          "[source_location]")
+{
+  char const* source = "first line\nlast line";
+  SourceLocation loc(Line(source + 11, 1), 0);
+
+  REQUIRE(loc.line().src() == "last line");
+  REQUIRE(loc.line().begin() == source + 11);
+}
+
+TEST_CASE("Source locations should compare the text of their lines", "[source_location]")
+{
+  std::string first = "let x = 1\nprint x\n";
+  std::string second = first;
+
+  REQUIRE(SourceLocation(Line(first.c_str(), 0), 4) == SourceLocation(Line(second.c_str(), 0), 4));
+  // Parenthesized, as Catch would otherwise try to print a Line as a range
+  REQUIRE((Line(first.c_str(), 1) != Line(second.c_str(), 0)));
+  REQUIRE((Line(second.c_str(), 0) < Line(first.c_str() + 10, 1)));
+  REQUIRE((Line(first.c_str(), 0) < Line(second.c_str(), 1)));
+}
@@ -9,4 +9,5 @@ static constexpr auto ExitMissingSource = 254;
 static constexpr auto ExitCouldNotCreateTempDir = 253;
 static constexpr auto ExitSyntaxError = 252;
 static constexpr auto ExitCodeGenerationFailed = 251;
+static constexpr auto ExitInvalidBytecode = 250;
 }  // namespace jackal::util
@@ -9,24 +9,36 @@
 #include <optional>
 #include <ostream>
 #include <random>
+#include <sstream>
 #include <string>
 
 #include "util/exit.hpp"
+#include "util/source_buffer.hpp"
 
 namespace jackal::util
 {
 /// @brief Attempts to read a file's content from the filesystem.
 ///
-/// The file is read eagerly in its entirety without buffering.
+/// The file is read eagerly in its entirety without buffering. Regular files are copied once
+/// from a memory mapping; other files (such as pipes) are read through a stream.
 ///
+/// @see SourceBuffer to access a regular file's content without copying it
 /// @returns the file's contents if it could be read
 /// @returns std::nullopt if it could not be read for any reason.
 inline std::optional<std::string> read_file(std::filesystem::path const& path) noexcept
 {
-  std::string file;
+  if (auto buffer = SourceBuffer::map(path); buffer.has_value())
+  {
+    return std::string(buffer->view());
+  }
+
   try
   {
     std::ifstream inputStream(path);
+    if (!inputStream.is_open())
+    {
+      return std::nullopt;
+    }
     std::stringstream iss;
     iss << inputStream.rdbuf();
     return iss.str();
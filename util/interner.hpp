@@ -0,0 +1,186 @@
+#pragma once
+
+#include <algorithm>
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <functional>
+#include <memory>
+#include <optional>
+#include <string_view>
+#include <vector>
+
+namespace jackal::util
+{
+/// @brief A dense integer identifier for a string interned by an Interner.
+///
+/// Two Symbols from the same Interner are equal if and only if their strings are equal, so names
+/// can be compared and used as keys in constant time. Symbols are assigned consecutively from zero
+/// in order of first appearance and may therefore be used directly as indices.
+struct Symbol
+{
+  constexpr explicit Symbol(uint32_t id) noexcept : _id(id) {}
+
+  [[nodiscard]] constexpr uint32_t id() const noexcept { return _id; }
+
+  auto operator<=>(Symbol const&) const noexcept = default;
+
+ private:
+  uint32_t _id;
+};
+
+/// @brief Maps strings to Symbols for the duration of a compilation.
+///
+/// Interned strings are copied into storage owned by the Interner, so the string of a Symbol
+/// remains valid for as long as the Interner even if the source it was read from does not.
+///
+/// Lookups use an open-addressing table of hashes and Symbols with linear probing, kept at most
+/// half full. Strings are only compared when their full hashes match.
+struct Interner
+{
+  static constexpr std::size_t ChunkSize = 16 * 1024;
+  static constexpr std::size_t InitialCapacity = 1024;
+
+  Interner() noexcept : _slots(InitialCapacity) {}
+
+  /// @returns the Symbol of @p name, assigning the next Symbol if @p name has not been seen before
+  [[nodiscard]] Symbol intern(std::string_view name) noexcept
+  {
+    auto hashed = hash(name);
+    auto idx = probe(name, hashed);
+    if (_slots[idx].id != Empty)
+    {
+      return Symbol(_slots[idx].id);
+    }
+
+    auto id = static_cast<uint32_t>(_names.size());
+    _names.push_back(store(name));
+    _slots[idx] = {hashed, id};
+    if (_names.size() * 2 > _slots.size())
+    {
+      grow();
+    }
+    return Symbol(id);
+  }
+
+  /// @returns the Symbol of @p name if it has been interned, std::nullopt otherwise
+  [[nodiscard]] std::optional<Symbol> find(std::string_view name) const noexcept
+  {
+    auto const& slot = _slots[probe(name, hash(name))];
+    return slot.id != Empty ? std::optional(Symbol(slot.id)) : std::nullopt;
+  }
+
+  /// @returns the string that @p symbol was interned from
+  [[nodiscard]] std::string_view name(Symbol symbol) const noexcept
+  {
+    assert(symbol.id() < _names.size());
+    return _names[symbol.id()];
+  }
+
+  /// @returns the number of distinct strings interned, which is also the next Symbol to be assigned
+  [[nodiscard]] std::size_t size() const noexcept { return _names.size(); }
+
+ private:
+  static constexpr uint32_t Empty = UINT32_MAX;
+
+  struct Slot
+  {
+    uint64_t hash = 0;
+    uint32_t id = Empty;
+  };
+
+  /// Mixes the string eight bytes at a time; identifiers rarely span more than two words.
+  [[nodiscard]] static uint64_t hash(std::string_view name) noexcept
+  {
+    constexpr uint64_t Multiplier = 0xbf58476d1ce4e5b9;
+
+    uint64_t hashed = 0x9e3779b97f4a7c15 ^ name.size();
+    std::size_t offset = 0;
+    for (; offset + sizeof(uint64_t) <= name.size(); offset += sizeof(uint64_t))
+    {
+      uint64_t word = 0;
+      std::memcpy(&word, name.data() + offset, sizeof(word));
+      hashed = (hashed ^ word) * Multiplier;
+      hashed ^= hashed >> 31;
+    }
+
+    uint64_t tail = 0;
+    if (offset < name.size())
+    {
+      std::memcpy(&tail, name.data() + offset, name.size() - offset);
+    }
+    hashed = (hashed ^ tail) * Multiplier;
+    return hashed ^ (hashed >> 29);
+  }
+
+  /// @returns the index of the slot holding @p name, or of the empty slot where it belongs
+  [[nodiscard]] std::size_t probe(std::string_view name, uint64_t hashed) const noexcept
+  {
+    auto mask = _slots.size() - 1;
+    for (auto idx = hashed & mask;; idx = (idx + 1) & mask)
+    {
+      auto const& slot = _slots[idx];
+      if (slot.id == Empty || (slot.hash == hashed && _names[slot.id] == name))
+      {
+        return idx;
+      }
+    }
+  }
+
+  void grow() noexcept
+  {
+    std::vector<Slot> slots(_slots.size() * 2);
+    auto mask = slots.size() - 1;
+    for (auto const& slot : _slots)
+    {
+      if (slot.id == Empty)
+      {
+        continue;
+      }
+
+      auto idx = slot.hash & mask;
+      while (slots[idx].id != Empty)
+      {
+        idx = (idx + 1) & mask;
+      }
+      slots[idx] = slot;
+    }
+    _slots = std::move(slots);
+  }
+
+  std::string_view store(std::string_view name) noexcept
+  {
+    if (name.empty())
+    {
+      return {};
+    }
+
+    if (static_cast<std::size_t>(_end - _cursor) < name.size())
+    {
+      auto chunkSize = std::max(ChunkSize, name.size());
+      _chunks.emplace_back(std::make_unique_for_overwrite<char[]>(chunkSize));  // NOLINT
+      _cursor = _chunks.back().get();
+      _end = _cursor + chunkSize;
+    }
+
+    std::memcpy(_cursor, name.data(), name.size());
+    std::string_view stored(_cursor, name.size());
+    _cursor += name.size();
+    return stored;
+  }
+
+ private:
+  std::vector<std::unique_ptr<char[]>> _chunks;  // NOLINT
+  char* _cursor = nullptr;
+  char* _end = nullptr;
+  std::vector<std::string_view> _names;
+  std::vector<Slot> _slots;
+};
+}  // namespace jackal::util
+
+template <>
+struct std::hash<jackal::util::Symbol>
+{
+  std::size_t operator()(jackal::util::Symbol symbol) const noexcept { return symbol.id(); }
+};
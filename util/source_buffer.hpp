@@ -0,0 +1,121 @@
+#pragma once
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <cstddef>
+#include <filesystem>
+#include <optional>
+#include <string_view>
+#include <utility>
+
+namespace jackal::util
+{
+/// @brief Read-only source code mapped directly from a file on disk.
+///
+/// The lexer operates on NUL-terminated character sequences. A SourceBuffer guarantees that the
+/// byte immediately following the file's content is readable and is '\0', without copying the file
+/// into memory: the file is mapped over the start of a zero-filled anonymous mapping that is at
+/// least one byte larger than the file. Everything from the end of the file to the end of the
+/// last mapped page therefore reads as '\0'.
+///
+/// Pointers into the buffer (such as the lexemes of lexed Tokens) remain valid until the
+/// SourceBuffer is destroyed.
+struct SourceBuffer
+{
+  /// @brief Attempts to map a file's content into memory.
+  ///
+  /// @returns std::nullopt if the file cannot be opened, is not a regular file, or cannot be mapped
+  /// @returns the mapped file otherwise
+  [[nodiscard]] static std::optional<SourceBuffer> map(std::filesystem::path const& path) noexcept
+  {
+    int fd = ::open(path.c_str(), O_RDONLY | O_CLOEXEC);  // NOLINT
+    if (fd < 0)
+    {
+      return std::nullopt;
+    }
+
+    struct stat status
+    {
+    };
+    if (::fstat(fd, &status) != 0 || !S_ISREG(status.st_mode))  // NOLINT
+    {
+      ::close(fd);
+      return std::nullopt;
+    }
+
+    auto size = static_cast<std::size_t>(status.st_size);
+    auto pageSize = static_cast<std::size_t>(::sysconf(_SC_PAGESIZE));
+    auto mappedSize = (size / pageSize + 1) * pageSize;
+
+    void* base = ::mmap(nullptr, mappedSize, PROT_READ, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    if (base == MAP_FAILED)  // NOLINT
+    {
+      ::close(fd);
+      return std::nullopt;
+    }
+
+    if (size > 0)
+    {
+      void* file = ::mmap(base, size, PROT_READ, MAP_PRIVATE | MAP_FIXED, fd, 0);
+      if (file == MAP_FAILED)  // NOLINT
+      {
+        ::munmap(base, mappedSize);
+        ::close(fd);
+        return std::nullopt;
+      }
+      ::madvise(base, size, MADV_SEQUENTIAL);
+    }
+
+    ::close(fd);
+    return SourceBuffer(static_cast<char const*>(base), size, mappedSize);
+  }
+
+  ~SourceBuffer() noexcept
+  {
+    if (_data != nullptr)
+    {
+      ::munmap(const_cast<char*>(_data), _mappedSize);  // NOLINT
+    }
+  }
+
+  SourceBuffer(SourceBuffer const&) = delete;
+  SourceBuffer& operator=(SourceBuffer const&) = delete;
+
+  SourceBuffer(SourceBuffer&& other) noexcept
+      : _data(std::exchange(other._data, nullptr)),
+        _size(std::exchange(other._size, 0)),
+        _mappedSize(std::exchange(other._mappedSize, 0))
+  {
+  }
+
+  SourceBuffer& operator=(SourceBuffer&& other) noexcept
+  {
+    std::swap(_data, other._data);
+    std::swap(_size, other._size);
+    std::swap(_mappedSize, other._mappedSize);
+    return *this;
+  }
+
+  /// @returns the NUL-terminated content of the file
+  [[nodiscard]] char const* data() const noexcept { return _data; }
+
+  /// @returns the size of the file's content, excluding the NUL terminator
+  [[nodiscard]] std::size_t size() const noexcept { return _size; }
+
+  /// @returns the content of the file
+  [[nodiscard]] std::string_view view() const noexcept { return {_data, _size}; }
+
+ private:
+  char const* _data;
+  std::size_t _size;
+  std::size_t _mappedSize;
+
+  SourceBuffer(char const* data, std::size_t size, std::size_t mappedSize) noexcept
+      : _data(data), _size(size), _mappedSize(mappedSize)
+  {
+  }
+};
+}  // namespace jackal::util
@@ -1,5 +1,7 @@
 #pragma once
 
+#include <compare>
+#include <cstddef>
 #include <cstdint>
 #include <sstream>
 #include <string>
@@ -20,28 +22,57 @@ using Column = Phantom<ColumnTag, uint64_t>;
 ///
 /// Working with @p Line allows for greatly simplified error messaging and diagnostics
 /// throughout the compiler infrastructure.
+///
+/// A Line is only a reference to the start of the line within the source; the text of the line
+/// is not located until it is requested by src(). Constructing a Line is therefore constant-time
+/// regardless of the size of the source, which keeps lexing linear in the length of the input.
 struct Line
 {
   /// @brief Constructs a Line from a location within the source code.
   ///
   /// @param line a pointer to the beginning of the line
   /// @param lineNum the 0-based index to the number of the line within the source file
-  constexpr Line(char const* line, uint64_t lineNum) noexcept : _num(lineNum)
+  constexpr Line(char const* line, uint64_t lineNum) noexcept : _begin(line), _num(lineNum) {}
+
+  /// @brief Materializes the line of source code.
+  ///
+  /// This scans forward to the end of the line and should be reserved for diagnostics.
+  ///
+  /// @returns the line of source code
+  [[nodiscard]] constexpr std::string_view src() const noexcept
   {
-    std::string_view rawLine(line);
-    _src = rawLine.substr(0, rawLine.find('\n'));
+    std::size_t length = 0;
+    while (_begin[length] != '\n' && _begin[length] != '\0')
+    {
+      ++length;
+    }
+    return {_begin, length};
   }
 
-  /// @returns the line of source code
-  [[nodiscard]] constexpr std::string_view src() const noexcept { return _src; }
+  /// @returns a pointer to the beginning of the line within the source code
+  [[nodiscard]] constexpr char const* begin() const noexcept { return _begin; }
 
   /// @returns the line number
   [[nodiscard]] constexpr uint64_t num() const noexcept { return _num; }
 
-  auto operator<=>(Line const&) const noexcept = default;
+  /// Lines are compared by their text and number, not by where they are located, so that the same
+  /// line read into two buffers compares equal.
+  [[nodiscard]] constexpr bool operator==(Line const& other) const noexcept
+  {
+    return _num == other._num && src() == other.src();
+  }
+
+  [[nodiscard]] constexpr std::strong_ordering operator<=>(Line const& other) const noexcept
+  {
+    if (auto order = src() <=> other.src(); order != 0)
+    {
+      return order;
+    }
+    return _num <=> other._num;
+  }
 
  private:
-  std::string_view _src;
+  char const* _begin;
   uint64_t _num;
 };
 